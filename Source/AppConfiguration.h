@@ -73,6 +73,8 @@ public:
         MUSELVISUENABLED,
         SEARCHFORUPDATES,
         SETTINGS,
+        RECONNECTBACKOFF,
+        BULKFETCH,
     };
     static String getTagName(TagID ID)
     {
@@ -158,6 +160,10 @@ public:
             return "SearchForUpdates";
         case SETTINGS:
             return "Settings";
+        case RECONNECTBACKOFF:
+            return "ReconnectBackoff";
+        case BULKFETCH:
+            return "BulkFetch";
         default:
             return "INVALID";
         }
@@ -174,6 +180,12 @@ public:
         INDEXMINOR,
         NAME,
         EXPANDED,
+        INITIALDELAY,
+        MAXDELAY,
+        JITTER,
+        MAXATTEMPTS,
+        WINDOW,
+        TIMEOUT,
     };
     static String getAttributeName(AttributeID Id)
     {
@@ -197,6 +209,18 @@ public:
             return "Name";
         case EXPANDED:
             return "Expanded";
+        case INITIALDELAY:
+            return "InitialDelay";
+        case MAXDELAY:
+            return "MaxDelay";
+        case JITTER:
+            return "Jitter";
+        case MAXATTEMPTS:
+            return "MaxAttempts";
+        case WINDOW:
+            return "Window";
+        case TIMEOUT:
+            return "Timeout";
         default:
             return "INVALID";
         }
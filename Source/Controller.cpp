@@ -37,6 +37,7 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Controller.h"
 #include "WaitingEntertainerComponent.h"
 #include "ProcessorSelectionManager.h"
+#include "LevelMeterPipeline.h"
 
 #include "PagedUI/PageComponentManager.h"
 #include "PagedUI/PageContainerComponent.h"
@@ -91,9 +92,12 @@ Controller::Controller()
 	SetSecondDS100IpAndPort(DCP_Init, juce::IPAddress(PROTOCOL_DEFAULT2_IP), RX_PORT_DS100_DEVICE, true);
 	SetExtensionMode(DCP_Init, EM_Off, true);
 	SetActiveParallelModeDS100(DCP_Init, APM_None, true);
+	SetDS100MirrorFailoverTime(DCP_Init, DS100_MIRROR_FAILOVERTIME_DEF, true);
 
 	m_pollingHelper = std::make_unique<Controller::StandaloneActiveObjectsPollingHelper>(PROTOCOL_INTERVAL_STATIC_OBJS);
 
+	m_levelMeterPipeline = std::make_unique<LevelMeterPipeline>();
+
 	s_constructionFinished = true;
 }
 
@@ -277,6 +281,11 @@ std::vector<RemoteObject> Controller::GetAllStandaloneActiveRemoteObjectsToUse()
 	// initially add all RemoteObjects registered as required for standalone app components 
 	std::vector<RemoteObject> remoteObjects = GetStandaloneActiveRemoteObjects();
 
+	// keep track of the objects already added, to not have to scan the list for every further object
+	auto addedRemoteObjects = std::set<std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t>>();
+	for (auto const& ro : remoteObjects)
+		addedRemoteObjects.insert(GetStandaloneActiveRemoteObjectKey(ro._Id, ro._Addr));
+
 	if (IsStaticProcessorRemoteObjectsPollingEnabled())
 	{
 		// add all RemoteObjects that are specifically required for soundobject related UI
@@ -291,7 +300,7 @@ std::vector<RemoteObject> Controller::GetAllStandaloneActiveRemoteObjectsToUse()
 				else
 				{
 					auto sosro = RemoteObject(roi, RemoteObjectAddressing(processor->GetSoundobjectId(), INVALID_ADDRESS_VALUE));
-					if (std::find(remoteObjects.begin(), remoteObjects.end(), sosro) == remoteObjects.end())
+					if (addedRemoteObjects.insert(GetStandaloneActiveRemoteObjectKey(sosro._Id, sosro._Addr)).second)
 						remoteObjects.push_back(sosro);
 				}
 			}
@@ -309,7 +318,7 @@ std::vector<RemoteObject> Controller::GetAllStandaloneActiveRemoteObjectsToUse()
 				else
 				{
 					auto misro = RemoteObject(roi, RemoteObjectAddressing(processor->GetMatrixInputId(), INVALID_ADDRESS_VALUE));
-					if (std::find(remoteObjects.begin(), remoteObjects.end(), misro) == remoteObjects.end())
+					if (addedRemoteObjects.insert(GetStandaloneActiveRemoteObjectKey(misro._Id, misro._Addr)).second)
 						remoteObjects.push_back(misro);
 				}
 			}
@@ -327,7 +336,7 @@ std::vector<RemoteObject> Controller::GetAllStandaloneActiveRemoteObjectsToUse()
 				else
 				{
 					auto mosro = RemoteObject(roi, RemoteObjectAddressing(processor->GetMatrixOutputId(), INVALID_ADDRESS_VALUE));
-					if (std::find(remoteObjects.begin(), remoteObjects.end(), mosro) == remoteObjects.end())
+					if (addedRemoteObjects.insert(GetStandaloneActiveRemoteObjectKey(mosro._Id, mosro._Addr)).second)
 						remoteObjects.push_back(mosro);
 				}
 			}
@@ -367,15 +376,17 @@ void Controller::SetStaticProcessorRemoteObjectsPollingEnabled(DataChangePartici
 /**
  * Getter for the list of remote objects that are handled
  * standalone active (read from DS100) as a flat list copy.
+ * Objects registered by multiple listeners are contained once.
  * @return	The internal list of remote objects.
  */
 const std::vector<RemoteObject> Controller::GetStandaloneActiveRemoteObjects()
 {
 	std::vector<RemoteObject> currentStandaloneActiveRemoteObjects;
-	for (auto const& objectsPerListener : m_standaloneActiveRemoteObjects)
+	currentStandaloneActiveRemoteObjects.reserve(m_standaloneActiveRemoteObjectListeners.size());
+	for (auto const& listenersPerObject : m_standaloneActiveRemoteObjectListeners)
 	{
-		for (auto const& ro : objectsPerListener.second)
-			currentStandaloneActiveRemoteObjects.push_back(ro);
+		auto const& key = listenersPerObject.first;
+		currentStandaloneActiveRemoteObjects.push_back(RemoteObject(std::get<0>(key), RemoteObjectAddressing(std::get<1>(key), std::get<2>(key))));
 	}
 
 	return currentStandaloneActiveRemoteObjects;
@@ -402,8 +413,11 @@ const std::vector<RemoteObject>& Controller::GetStandaloneActiveRemoteObjects(Co
  */
 bool Controller::ContainsStandaloneActiveRemoteObject(Controller::StandaloneActiveObjectsListener* listener, const RemoteObject& remoteObject)
 {
-	auto objIter = std::find(GetStandaloneActiveRemoteObjects(listener).begin(), GetStandaloneActiveRemoteObjects(listener).end(), remoteObject);
-	return (objIter != GetStandaloneActiveRemoteObjects(listener).end());
+	auto listenersIter = m_standaloneActiveRemoteObjectListeners.find(GetStandaloneActiveRemoteObjectKey(remoteObject._Id, remoteObject._Addr));
+	if (listenersIter == m_standaloneActiveRemoteObjectListeners.end())
+		return false;
+
+	return std::find(listenersIter->second.begin(), listenersIter->second.end(), listener) != listenersIter->second.end();
 }
 
 /**
@@ -426,6 +440,13 @@ bool Controller::AddStandaloneActiveRemoteObject(Controller::StandaloneActiveObj
 	{
 		// if all was ok, add the object for the listener
 		m_standaloneActiveRemoteObjects[listener].push_back(remoteObject);
+		auto& listenersForObject = m_standaloneActiveRemoteObjectListeners[GetStandaloneActiveRemoteObjectKey(remoteObject._Id, remoteObject._Addr)];
+		listenersForObject.push_back(listener);
+
+		// fetch the value of an object that was not registered before right away, instead of waiting for the next polling interval
+		if (m_pollingHelper && listenersForObject.size() == 1 && IsPollingDS100ProtocolType())
+			m_pollingHelper->BulkFetch({ remoteObject });
+
 		return true;
 	}
 }
@@ -448,6 +469,7 @@ bool Controller::RemoveStandaloneActiveRemoteObject(Controller::StandaloneActive
 	{
 		// if all was ok, remove the object
 		m_standaloneActiveRemoteObjects[listener].erase(objIter);
+		RemoveStandaloneActiveRemoteObjectListener(listener, remoteObject);
 		return true;
 	}
 }
@@ -492,6 +514,8 @@ bool Controller::AddStandaloneActiveObjectsListener(Controller::StandaloneActive
  */
 bool Controller::RemoveStandaloneActiveObjectsListener(Controller::StandaloneActiveObjectsListener* listener)
 {
+	for (auto const& remoteObject : m_standaloneActiveRemoteObjects[listener])
+		RemoveStandaloneActiveRemoteObjectListener(listener, remoteObject);
 	m_standaloneActiveRemoteObjects.erase(listener);
 
 	auto listenerIter = std::find(m_standaloneActiveObjectListeners.begin(), m_standaloneActiveObjectListeners.end(), listener);
@@ -504,6 +528,35 @@ bool Controller::RemoveStandaloneActiveObjectsListener(Controller::StandaloneAct
 		return false;
 }
 
+/**
+ * Helper to remove a listener from the index of listeners registered for a standalone active remote object.
+ * The object is removed from the index when no listener is left for it.
+ * @param	listener		The listener instance to remove
+ * @param	remoteObject	The object to remove the listener for
+ */
+void Controller::RemoveStandaloneActiveRemoteObjectListener(Controller::StandaloneActiveObjectsListener* listener, const RemoteObject& remoteObject)
+{
+	auto listenersIter = m_standaloneActiveRemoteObjectListeners.find(GetStandaloneActiveRemoteObjectKey(remoteObject._Id, remoteObject._Addr));
+	if (listenersIter == m_standaloneActiveRemoteObjectListeners.end())
+		return;
+
+	auto& listeners = listenersIter->second;
+	listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+	if (listeners.empty())
+		m_standaloneActiveRemoteObjectListeners.erase(listenersIter);
+}
+
+/**
+ * Helper to create the key of a standalone active remote object, as used in the index of registered listeners.
+ * @param	roi		The remote object identifier
+ * @param	addr	The remote object addressing
+ * @return	The key of the object.
+ */
+std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t> Controller::GetStandaloneActiveRemoteObjectKey(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& addr)
+{
+	return std::make_tuple(roi, static_cast<std::int32_t>(addr._first), static_cast<std::int32_t>(addr._second));
+}
+
 /**
  * Updates the remote objects that are currently being actively handled.
  * @param dontSendNotification	Flag if the app configuration update should be triggered (fwd. to bridging wrapper).
@@ -897,6 +950,17 @@ std::vector<MatrixInputProcessorId> Controller::GetMatrixInputProcessorIds() con
 	return processorIds;
 }
 
+/**
+ * Getter for all currently active processors, to iterate them in one pass
+ * instead of looking every single one up by its processorId.
+ * @return	The vector of active processors
+ */
+std::vector<MatrixInputProcessor*> Controller::GetMatrixInputProcessors() const
+{
+	const ScopedLock lock(m_mutex);
+	return std::vector<MatrixInputProcessor*>(m_matrixInputProcessors.begin(), m_matrixInputProcessors.end());
+}
+
 
 /**
  * Helper method to create a new processor incl. implicit triggering of
@@ -1078,6 +1142,17 @@ std::vector<MatrixOutputProcessorId> Controller::GetMatrixOutputProcessorIds() c
 	return processorIds;
 }
 
+/**
+ * Getter for all currently active processors, to iterate them in one pass
+ * instead of looking every single one up by its processorId.
+ * @return	The vector of active processors
+ */
+std::vector<MatrixOutputProcessor*> Controller::GetMatrixOutputProcessors() const
+{
+	const ScopedLock lock(m_mutex);
+	return std::vector<MatrixOutputProcessor*>(m_matrixOutputProcessors.begin(), m_matrixOutputProcessors.end());
+}
+
 
 /**
  * Getter function for the DS100 protocol type currently used.
@@ -1394,6 +1469,8 @@ void Controller::SetExtensionMode(DataChangeParticipant changeSource, ExtensionM
 		m_DS100ExtensionMode = mode;
 
 		m_protocolBridge.SetDS100ExtensionMode(mode, dontSendNotification);
+		if (mode == EM_Mirror)
+			m_protocolBridge.SetDS100MirrorFailoverTime(m_DS100MirrorFailoverTime, dontSendNotification);
 
 		// Signal the change to all Processors. 
 		SetParameterChanged(changeSource, DCT_ExtensionMode);
@@ -1436,6 +1513,41 @@ void Controller::SetActiveParallelModeDS100(DataChangeParticipant changeSource,
 	}
 }
 
+/**
+ * Getter function for the failover time in extension mode "mirror".
+ * @return	Current failover time, in milliseconds.
+ */
+int Controller::GetDS100MirrorFailoverTime() const
+{
+	return m_DS100MirrorFailoverTime;
+}
+
+/**
+ * Setter function for the failover time in extension mode "mirror".
+ * This is the time without reaction of the master DS100, after which the slave DS100 takes over.
+ * @param changeSource	The application module which is causing the property change.
+ * @param failoverTime	New failover time, in milliseconds.
+ * @param dontSendNotification	Flag if the app configuration should be triggered to be updated
+ */
+void Controller::SetDS100MirrorFailoverTime(DataChangeParticipant changeSource, int failoverTime, bool dontSendNotification)
+{
+	// Clip time to the allowed range.
+	failoverTime = juce::jlimit(DS100_MIRROR_FAILOVERTIME_MIN, DS100_MIRROR_FAILOVERTIME_MAX, failoverTime);
+
+	if (m_DS100MirrorFailoverTime != failoverTime)
+	{
+		const ScopedLock lock(m_mutex);
+
+		m_DS100MirrorFailoverTime = failoverTime;
+
+		if (GetExtensionMode() == EM_Mirror)
+			m_protocolBridge.SetDS100MirrorFailoverTime(failoverTime, dontSendNotification);
+
+		// Signal the change to all Processors. 
+		SetParameterChanged(changeSource, DCT_ExtensionMode);
+	}
+}
+
 /**
  * Getter for the dummy project config data set for DS100 'None' protocol.
  * @return	Current string dummy project config data.
@@ -1520,27 +1632,27 @@ void Controller::HandleMessageData(NodeId nodeId, ProtocolId senderProtocolId, R
 		// from DS100 - any data that was sent by 3rd party devices 
 		// is bridged to DS100 and returned by it 
 		// so we can handle the data in the end as well
-		if (senderProtocolId != DS100_1_PROCESSINGPROTOCOL_ID && senderProtocolId != DS100_2_PROCESSINGPROTOCOL_ID)
+		if (ProtocolBridgingWrapper::GetDS100DeviceIndex(senderProtocolId) < 0)
 			return;
 	}
 
-	if (GetExtensionMode() == EM_Parallel)
-	{
-		// Do neither handle any protocol data from second DS100 if first is set as active one...
-		if (GetActiveParallelModeDS100() == APM_1st && senderProtocolId != DS100_1_PROCESSINGPROTOCOL_ID)
-			return;
-		// ...nor any protocol data from first DS100 if second is set as active one in parallel extension mode.
-		if (GetActiveParallelModeDS100() == APM_2nd && senderProtocolId != DS100_2_PROCESSINGPROTOCOL_ID)
-			return;
-	}
+	// In parallel extension mode, only protocol data from the DS100 that is set as active one is handled
+	if (!m_protocolBridge.IsReceptionFromProtocolEnabled(senderProtocolId))
+		return;
+
+	// a changed value resets the polling backoff of the object and a bulk fetch continues with the next object
+	if (m_pollingHelper)
+		m_pollingHelper->HandleReceivedValue(objectId, msgData, m_protocolBridge.GetDS100ChannelOffset(senderProtocolId));
 
 	// notify all listeners that registered for the incoming object
-	for (auto const& listener : m_standaloneActiveObjectListeners)
+	auto listenersIter = m_standaloneActiveRemoteObjectListeners.find(GetStandaloneActiveRemoteObjectKey(objectId, msgData._addrVal));
+	if (listenersIter != m_standaloneActiveRemoteObjectListeners.end())
 	{
-		if (listener)
+		// copy, since listeners might register or unregister objects when handling the data
+		auto listeners = listenersIter->second;
+		for (auto const& listener : listeners)
 		{
-			auto& objsForListener = GetStandaloneActiveRemoteObjects(listener);
-			if (std::find(objsForListener.begin(), objsForListener.end(), RemoteObject(objectId, msgData._addrVal)) != objsForListener.end())
+			if (listener)
 				listener->HandleObjectDataInternal(objectId, msgData);
 		}
 	}
@@ -1734,13 +1846,40 @@ void Controller::HandleMessageData(NodeId nodeId, ProtocolId senderProtocolId, R
 		break;
 	}
 
-	// If soundobject/matrixInput/matrixOutput id is present, it needs to be checked regarding special DS100 extension mode
-	if (soundobjectId > 0 && senderProtocolId == DS100_2_PROCESSINGPROTOCOL_ID && GetExtensionMode() == EM_Extend)
-		soundobjectId += DS100_CHANNELCOUNT;
-	if (matrixInputId > 0 && senderProtocolId == DS100_2_PROCESSINGPROTOCOL_ID && GetExtensionMode() == EM_Extend)
-		matrixInputId += DS100_CHANNELCOUNT;
-	if (matrixOutputId > 0 && senderProtocolId == DS100_2_PROCESSINGPROTOCOL_ID && GetExtensionMode() == EM_Extend)
-		matrixOutputId += DS100_CHANNELCOUNT;
+	// If soundobject/matrixInput/matrixOutput id is present, it needs to be mapped regarding special DS100 extension mode
+	auto ds100ChannelOffset = m_protocolBridge.GetDS100ChannelOffset(senderProtocolId);
+	if (soundobjectId > 0)
+		soundobjectId += ds100ChannelOffset;
+	if (matrixInputId > 0)
+		matrixInputId += ds100ChannelOffset;
+	if (matrixOutputId > 0)
+		matrixOutputId += ds100ChannelOffset;
+
+	// Level meter values are not applied to the processors per message, but collected in the level meter pipeline,
+	// that commits them to the processors in one batched pass at ui rate, decoupled from the protocol rate.
+	if ((change == DCT_MatrixInputLevelMeter || change == DCT_MatrixOutputLevelMeter) && m_levelMeterPipeline)
+	{
+		auto newValue = 0.0f;
+		switch (msgData._valType)
+		{
+		case RemoteObjectValueType::ROVT_INT:
+			newValue = static_cast<float>(*(static_cast<int*>(msgData._payload)));
+			break;
+		case RemoteObjectValueType::ROVT_FLOAT:
+			newValue = *(static_cast<float*>(msgData._payload));
+			break;
+		case RemoteObjectValueType::ROVT_NONE:
+		default:
+			return;
+		}
+
+		if (change == DCT_MatrixInputLevelMeter)
+			m_levelMeterPipeline->SetMatrixInputLevel(matrixInputId, newValue);
+		else
+			m_levelMeterPipeline->SetMatrixOutputLevel(matrixOutputId, newValue);
+
+		return;
+	}
 
 	// now process what changes were detected to be neccessary to perform
 	if (change == DCT_ProcessorSelection)
@@ -1995,6 +2134,10 @@ void Controller::handleMessage(const Message& message)
 
 bool Controller::SendMessageDataDirect(const RemoteObjectIdentifier roi, RemoteObjectMessageData& msgData)
 {
+	// a value set locally resets the polling backoff of the object
+	if (m_pollingHelper && msgData._valType != ROVT_NONE)
+		m_pollingHelper->ResetPollBackoff(roi, msgData);
+
 	return m_protocolBridge.SendMessage(roi, msgData);
 }
 
@@ -2020,6 +2163,126 @@ void Controller::Reconnect()
 	m_protocolBridge.Reconnect();
 }
 
+/**
+ * Getter for the backoff parameters used to recover lost DS100s.
+ * @return	The backoff parameters.
+ */
+const ReconnectManager::BackoffPolicy Controller::GetReconnectBackoffPolicy()
+{
+	return m_protocolBridge.GetReconnectBackoffPolicy();
+}
+
+/**
+ * Setter for the backoff parameters used to recover lost DS100s.
+ * @param policy	The backoff parameters to use.
+ */
+void Controller::SetReconnectBackoffPolicy(const ReconnectManager::BackoffPolicy& policy)
+{
+	m_protocolBridge.SetReconnectBackoffPolicy(policy);
+}
+
+/**
+ * Getter for the timeline of DS100 state changes and reconnects.
+ * @return	The timeline entries, oldest first.
+ */
+const std::vector<ReconnectManager::TimelineEntry> Controller::GetReconnectTimeline()
+{
+	return m_protocolBridge.GetReconnectTimeline();
+}
+
+/**
+ * Getter for the count of timeline entries that were ever added, to detect timeline changes.
+ * @return	The count of entries ever added.
+ */
+int Controller::GetReconnectTimelineEntryCount()
+{
+	return m_protocolBridge.GetReconnectTimelineEntryCount();
+}
+
+/**
+ * Getter for the count of polls the standalone active objects polling helper sent, to show in statistics.
+ * @return	The count of polls sent since start.
+ */
+int Controller::GetStandalonePollSentCount()
+{
+	return m_pollingHelper ? m_pollingHelper->GetSentPollCount() : 0;
+}
+
+/**
+ * Getter for the count of polls the standalone active objects polling helper skipped
+ * for objects with unchanged values, to show in statistics.
+ * @return	The count of polls skipped since start.
+ */
+int Controller::GetStandalonePollSkippedCount()
+{
+	return m_pollingHelper ? m_pollingHelper->GetSkippedPollCount() : 0;
+}
+
+/**
+ * Getter for the maximum count of bulk fetch polls the standalone active objects polling helper keeps in flight.
+ * @return	The bulk fetch window.
+ */
+int Controller::GetStandaloneBulkFetchWindow()
+{
+	return m_pollingHelper ? m_pollingHelper->GetBulkFetchWindow() : StandaloneActiveObjectsPollingHelper::BULK_FETCH_WINDOW_DEF;
+}
+
+/**
+ * Setter for the maximum count of bulk fetch polls the standalone active objects polling helper keeps in flight.
+ * @param window	The bulk fetch window to set.
+ */
+void Controller::SetStandaloneBulkFetchWindow(int window)
+{
+	if (m_pollingHelper)
+		m_pollingHelper->SetBulkFetchWindow(window);
+}
+
+/**
+ * Getter for the time without a received value, after which the standalone active objects polling helper gives up a bulk fetch.
+ * @return	The bulk fetch timeout in ms.
+ */
+int Controller::GetStandaloneBulkFetchTimeout()
+{
+	return m_pollingHelper ? m_pollingHelper->GetBulkFetchTimeout() : StandaloneActiveObjectsPollingHelper::BULK_FETCH_TIMEOUT_DEF;
+}
+
+/**
+ * Setter for the time without a received value, after which the standalone active objects polling helper gives up a bulk fetch.
+ * @param timeout	The bulk fetch timeout in ms to set.
+ */
+void Controller::SetStandaloneBulkFetchTimeout(int timeout)
+{
+	if (m_pollingHelper)
+		m_pollingHelper->SetBulkFetchTimeout(timeout);
+}
+
+/**
+ * Getter for the count of bulk fetches that received all values, to show in statistics.
+ * @return	The count of completed bulk fetches since start.
+ */
+int Controller::GetStandaloneBulkFetchCompletedCount()
+{
+	return m_pollingHelper ? m_pollingHelper->GetBulkFetchCompletedCount() : 0;
+}
+
+/**
+ * Getter for the count of bulk fetches that were given up due to missing values, to show in statistics.
+ * @return	The count of given up bulk fetches since start.
+ */
+int Controller::GetStandaloneBulkFetchGivenUpCount()
+{
+	return m_pollingHelper ? m_pollingHelper->GetBulkFetchGivenUpCount() : 0;
+}
+
+/**
+ * Getter for the duration of the latest completed or given up bulk fetch, to show in statistics.
+ * @return	The duration in ms.
+ */
+int Controller::GetStandaloneBulkFetchLastDuration()
+{
+	return m_pollingHelper ? m_pollingHelper->GetBulkFetchLastDuration() : 0;
+}
+
 void Controller::tick()
 {
 	if (IsTickProcessingStopped())
@@ -2531,6 +2794,26 @@ bool Controller::setStateXml(XmlElement* stateXml)
 			SetStaticProcessorRemoteObjectsPollingEnabled(DCP_Init, staticObjectsPollingStateTextXmlElement->getAllSubText().getIntValue() == 1);
 	}
 
+	// set reconnect backoff parameters from xml
+	auto reconnectBackoffXmlElement = stateXml->getChildByName(AppConfiguration::getTagName(AppConfiguration::TagID::RECONNECTBACKOFF));
+	if (reconnectBackoffXmlElement)
+	{
+		auto policy = GetReconnectBackoffPolicy();
+		policy._initialDelay = reconnectBackoffXmlElement->getIntAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::INITIALDELAY), policy._initialDelay);
+		policy._maxDelay = reconnectBackoffXmlElement->getIntAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::MAXDELAY), policy._maxDelay);
+		policy._jitter = reconnectBackoffXmlElement->getIntAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::JITTER), policy._jitter);
+		policy._maxAttempts = reconnectBackoffXmlElement->getIntAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::MAXATTEMPTS), policy._maxAttempts);
+		SetReconnectBackoffPolicy(policy);
+	}
+
+	// set standalone objects bulk fetch parameters from xml
+	auto bulkFetchXmlElement = stateXml->getChildByName(AppConfiguration::getTagName(AppConfiguration::TagID::BULKFETCH));
+	if (bulkFetchXmlElement)
+	{
+		SetStandaloneBulkFetchWindow(bulkFetchXmlElement->getIntAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::WINDOW), GetStandaloneBulkFetchWindow()));
+		SetStandaloneBulkFetchTimeout(bulkFetchXmlElement->getIntAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::TIMEOUT), GetStandaloneBulkFetchTimeout()));
+	}
+
 	// create soundobject processors from xml
 	auto soundobjectProcessorsXmlElement = stateXml->getChildByName(AppConfiguration::getTagName(AppConfiguration::TagID::SOUNDOBJECTPROCESSORS));
 	if (soundobjectProcessorsXmlElement)
@@ -2701,6 +2984,7 @@ bool Controller::setStateXml(XmlElement* stateXml)
 		if (m_protocolBridge.setStateXml(bridgingXmlElement))
 		{
 			SetDS100ProtocolType(DCP_Init, m_protocolBridge.GetDS100ProtocolType(), true);
+			SetDS100MirrorFailoverTime(DCP_Init, m_protocolBridge.GetDS100MirrorFailoverTime(), true); // before extension mode, that applies the failover time when switching to mirror mode
 			SetExtensionMode(DCP_Init, m_protocolBridge.GetDS100ExtensionMode(), true);
 			SetDS100IpAndPort(DCP_Init, m_protocolBridge.GetDS100IpAddress(), m_protocolBridge.GetDS100Port(), true);
 			SetSecondDS100IpAndPort(DCP_Init, m_protocolBridge.GetSecondDS100IpAddress(), m_protocolBridge.GetSecondDS100Port(), true);
@@ -2751,6 +3035,21 @@ std::unique_ptr<XmlElement> Controller::createStateXml()
 	else
 		staticObjectsPollingStateXmlElement->addTextElement(String(IsStaticProcessorRemoteObjectsPollingEnabled() ? 1 : 0));
 
+	auto reconnectBackoffXmlElement = controllerXmlElement->getChildByName(AppConfiguration::getTagName(AppConfiguration::TagID::RECONNECTBACKOFF));
+	if (!reconnectBackoffXmlElement)
+		reconnectBackoffXmlElement = controllerXmlElement->createNewChildElement(AppConfiguration::getTagName(AppConfiguration::TagID::RECONNECTBACKOFF));
+	auto reconnectBackoffPolicy = GetReconnectBackoffPolicy();
+	reconnectBackoffXmlElement->setAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::INITIALDELAY), reconnectBackoffPolicy._initialDelay);
+	reconnectBackoffXmlElement->setAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::MAXDELAY), reconnectBackoffPolicy._maxDelay);
+	reconnectBackoffXmlElement->setAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::JITTER), reconnectBackoffPolicy._jitter);
+	reconnectBackoffXmlElement->setAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::MAXATTEMPTS), reconnectBackoffPolicy._maxAttempts);
+
+	auto bulkFetchXmlElement = controllerXmlElement->getChildByName(AppConfiguration::getTagName(AppConfiguration::TagID::BULKFETCH));
+	if (!bulkFetchXmlElement)
+		bulkFetchXmlElement = controllerXmlElement->createNewChildElement(AppConfiguration::getTagName(AppConfiguration::TagID::BULKFETCH));
+	bulkFetchXmlElement->setAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::WINDOW), GetStandaloneBulkFetchWindow());
+	bulkFetchXmlElement->setAttribute(AppConfiguration::getAttributeName(AppConfiguration::AttributeID::TIMEOUT), GetStandaloneBulkFetchTimeout());
+
 	// create xml from soundobject processors
 	auto soundobjectProcessorsXmlElement = controllerXmlElement->createNewChildElement(AppConfiguration::getTagName(AppConfiguration::TagID::SOUNDOBJECTPROCESSORS));
 	if (soundobjectProcessorsXmlElement)
@@ -51,6 +51,7 @@ namespace SpaConBridge
 class SoundobjectProcessor;
 class MatrixInputProcessor;
 class MatrixOutputProcessor;
+class LevelMeterPipeline;
 
 
 /**
@@ -130,6 +131,7 @@ public:
 	int GetMatrixInputProcessorCount() const;
 	MatrixInputProcessor* GetMatrixInputProcessor(MatrixInputProcessorId processorId) const;
 	std::vector<MatrixInputProcessorId> GetMatrixInputProcessorIds() const;
+	std::vector<MatrixInputProcessor*> GetMatrixInputProcessors() const;
 	std::vector<RemoteObject> GetMatrixInputProcessorRemoteObjects(MatrixInputProcessorId matrixInputProcessorId);
 
 	//==========================================================================
@@ -140,6 +142,7 @@ public:
 	int GetMatrixOutputProcessorCount() const;
 	MatrixOutputProcessor* GetMatrixOutputProcessor(MatrixOutputProcessorId processorId) const;
 	std::vector<MatrixOutputProcessorId> GetMatrixOutputProcessorIds() const;
+	std::vector<MatrixOutputProcessor*> GetMatrixOutputProcessors() const;
 	std::vector<RemoteObject> GetMatrixOutputProcessorRemoteObjects(MatrixOutputProcessorId matrixOutputProcessorId);
 
 	//==========================================================================
@@ -166,6 +169,10 @@ public:
 	ActiveParallelModeDS100 GetActiveParallelModeDS100() const;
 	void SetActiveParallelModeDS100(DataChangeParticipant changeSource, ActiveParallelModeDS100 activeParallelModeDS100, bool dontSendNotification = false);
 
+	//==========================================================================
+	int GetDS100MirrorFailoverTime() const;
+	void SetDS100MirrorFailoverTime(DataChangeParticipant changeSource, int failoverTime, bool dontSendNotification = false);
+
 	//==========================================================================
 	juce::String GetDS100DummyProjectData() const;
 	void SetDS100DummyProjectData(DataChangeParticipant changeSource, const juce::String& projectDummyData, bool dontSendNotification = false);
@@ -263,6 +270,21 @@ public:
 	bool IsSecondDS100Connected() const;
 	bool IsSecondDS100Master() const;
 
+	//==========================================================================
+	const ReconnectManager::BackoffPolicy GetReconnectBackoffPolicy();
+	void SetReconnectBackoffPolicy(const ReconnectManager::BackoffPolicy& policy);
+	const std::vector<ReconnectManager::TimelineEntry> GetReconnectTimeline();
+	int GetReconnectTimelineEntryCount();
+	int GetStandalonePollSentCount();
+	int GetStandalonePollSkippedCount();
+	int GetStandaloneBulkFetchWindow();
+	void SetStandaloneBulkFetchWindow(int window);
+	int GetStandaloneBulkFetchTimeout();
+	void SetStandaloneBulkFetchTimeout(int timeout);
+	int GetStandaloneBulkFetchCompletedCount();
+	int GetStandaloneBulkFetchGivenUpCount();
+	int GetStandaloneBulkFetchLastDuration();
+
 	//==========================================================================
 	void SetOnline(DataChangeParticipant changeSource, bool online);
 	bool IsOnline() const;
@@ -291,15 +313,32 @@ public:
 	bool IsTickProcessingStopped();
 	void PostParameterChanged(DataChangeParticipant changeSource, DataChangeType changeTypes);
 private:
+	void RemoveStandaloneActiveRemoteObjectListener(Controller::StandaloneActiveObjectsListener* listener, const RemoteObject& remoteObject);
+	static std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t> GetStandaloneActiveRemoteObjectKey(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& addr);
+
 	/**
 	 * Class StandaloneActiveObjectsPollingHelper
 	 * @brief	Controller specific helper class
 	 *			that takes over the task of timerbased
 	 *			getting of values defined as standalone active in controller.
+	 *			The polls of one interval are spread evenly over a number of slots
+	 *			within the interval and limited to a maximum poll rate, instead of
+	 *			being sent in one burst per interval.
+	 *			Objects whose value did not change are polled exponentially less
+	 *			often, until a changed value is received or sent for them.
+	 *			Newly registered objects are fetched right away in a bulk fetch,
+	 *			that keeps a window of polls in flight and sends the next poll
+	 *			as soon as a value was received, instead of waiting for the interval.
 	 */
 	class StandaloneActiveObjectsPollingHelper : private Timer
 	{
 	public:
+		static constexpr int POLL_SLOT_COUNT = 10;		//< Count of slots the polls of one interval are spread over.
+		static constexpr int POLL_RATE_BUDGET = 500;	//< Maximum count of polls sent per second.
+		static constexpr int POLL_BACKOFF_MAX = 8;		//< Maximum count of intervals between two polls of an object with unchanged value.
+		static constexpr int BULK_FETCH_WINDOW_DEF = 16;		//< Default maximum count of bulk fetch polls in flight without a received value.
+		static constexpr int BULK_FETCH_TIMEOUT_DEF = 1000;	//< Default time in ms without a received value, after which a bulk fetch is given up and left to regular polling.
+
 		StandaloneActiveObjectsPollingHelper()
 		{
 			PollOnce();
@@ -321,7 +360,7 @@ private:
 			m_interval = interval;
 
 			if (m_running)
-				startTimer(interval);
+				startTimer(GetSlotInterval());
 		}
 
 		bool IsRunning()
@@ -334,7 +373,7 @@ private:
 			if (m_running != running)
 			{
 				if (running)
-					startTimer(GetInterval());
+					startTimer(GetSlotInterval());
 				else
 					stopTimer();
 
@@ -342,25 +381,238 @@ private:
 			}
 		}
 
+		int GetBulkFetchWindow()
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			return m_bulkFetchWindow;
+		}
+		void SetBulkFetchWindow(int window)
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			m_bulkFetchWindow = std::max(1, window);
+		}
+		int GetBulkFetchTimeout()
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			return m_bulkFetchTimeout;
+		}
+		void SetBulkFetchTimeout(int timeout)
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			m_bulkFetchTimeout = std::max(1, timeout);
+		}
+
 		void TriggerPollOnce(Controller::StandaloneActiveObjectsListener* listener)
 		{
 			if (nullptr == listener)
 				return PollOnce();
-			else if (Controller::GetInstance()->IsOnline())
+			else
+				BulkFetch(Controller::GetInstance()->GetStandaloneActiveRemoteObjects(listener));
+		}
+
+		void BulkFetch(const std::vector<RemoteObject>& remoteObjects)
+		{
+			if (!Controller::GetInstance()->IsOnline())
+				return;
+
+			const ScopedLock l(m_bulkFetchLock);
+			if (m_bulkFetchPending.empty() && m_bulkFetchInFlight.empty())
+				m_bulkFetchStartTime = m_bulkFetchProgressTime = juce::Time::getMillisecondCounter();
+
+			m_bulkFetchPending.insert(m_bulkFetchPending.end(), remoteObjects.begin(), remoteObjects.end());
+
+			SendBulkFetchPolls();
+		}
+
+		void HandleReceivedValue(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, std::int32_t channelOffset)
+		{
+			// objects are polled with application channels, so channels received from a further DS100 in extend mode are mapped back
+			auto channel = static_cast<std::int32_t>(msgData._addrVal._first);
+			if (channel > 0)
+				channel += channelOffset;
+			auto key = std::make_tuple(roi, channel, static_cast<std::int32_t>(msgData._addrVal._second));
+
+			// most received values are neither tracked for backoff nor awaited by a bulk fetch, so check without locking first
+			if (m_pollBackoffCount.get() > 0)
+				UpdatePollBackoff(key, msgData);
+
+			if (m_bulkFetchInFlightCount.get() == 0)
+				return;
+
+			const ScopedLock l(m_bulkFetchLock);
+			if (m_bulkFetchInFlight.erase(key) == 0)
+				return;
+			m_bulkFetchInFlightCount.set(static_cast<int>(m_bulkFetchInFlight.size()));
+
+			m_bulkFetchProgressTime = juce::Time::getMillisecondCounter();
+			SendBulkFetchPolls();
+
+			if (m_bulkFetchPending.empty() && m_bulkFetchInFlight.empty())
 			{
-				auto remoteObjectsToPoll = Controller::GetInstance()->GetStandaloneActiveRemoteObjects(listener);
-				for (auto const& remoteObject : remoteObjectsToPoll)
-				{
-					auto romd = RemoteObjectMessageData(remoteObject._Addr, ROVT_NONE, 0, nullptr, 0);
-					Controller::GetInstance()->SendMessageDataDirect(remoteObject._Id, romd);
-				}
+				m_bulkFetchCompletedCount++;
+				m_bulkFetchLastDuration = static_cast<int>(m_bulkFetchProgressTime - m_bulkFetchStartTime);
+				DBG(juce::String(__FUNCTION__) << " bulk fetch completed in " << m_bulkFetchLastDuration << "ms");
 			}
 		}
 
+		void ResetPollBackoff(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData)
+		{
+			const ScopedLock l(m_pollBackoffLock);
+			auto backoffIter = m_pollBackoff.find(std::make_tuple(roi, static_cast<std::int32_t>(msgData._addrVal._first), static_cast<std::int32_t>(msgData._addrVal._second)));
+			if (backoffIter != m_pollBackoff.end())
+				backoffIter->second._pollEvery = 1;
+		}
+
+		int GetSentPollCount()
+		{
+			const ScopedLock l(m_pollCountLock);
+			return m_sentPollCount;
+		}
+		int GetSkippedPollCount()
+		{
+			const ScopedLock l(m_pollCountLock);
+			return m_skippedPollCount;
+		}
+		int GetBulkFetchCompletedCount()
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			return m_bulkFetchCompletedCount;
+		}
+		int GetBulkFetchGivenUpCount()
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			return m_bulkFetchGivenUpCount;
+		}
+		int GetBulkFetchLastDuration()
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			return m_bulkFetchLastDuration;
+		}
+
 	private:
+		void UpdatePollBackoff(const std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t>& key, const RemoteObjectMessageData& msgData)
+		{
+			const ScopedLock l(m_pollBackoffLock);
+			auto backoffIter = m_pollBackoff.find(key);
+			if (backoffIter == m_pollBackoff.end() || msgData._payload == nullptr)
+				return;
+
+			auto payload = static_cast<const juce::uint8*>(msgData._payload);
+			auto value = std::vector<juce::uint8>(payload, payload + msgData._payloadSize);
+			if (value != backoffIter->second._lastValue)
+			{
+				backoffIter->second._lastValue = std::move(value);
+				backoffIter->second._pollEvery = 1;
+			}
+		}
+
+		/**
+		 * Polling backoff state of a single object.
+		 */
+		struct PollBackoff
+		{
+			int							_pollEvery{ 1 };			/**< The count of intervals between two polls, doubled per poll up to POLL_BACKOFF_MAX, reset on value change. */
+			int							_intervalsSincePoll{ 0 };	/**< The count of intervals since the object was last polled. */
+			std::vector<juce::uint8>	_lastValue;					/**< The payload last received for the object. */
+		};
+
+		int GetSlotInterval()
+		{
+			return std::max(1, m_interval / POLL_SLOT_COUNT);
+		}
+
 		void timerCallback() override
 		{
-			PollOnce();
+			CheckBulkFetchTimeout();
+			PollSlot();
+		}
+		void SendBulkFetchPolls()
+		{
+			while (!m_bulkFetchPending.empty() && m_bulkFetchInFlight.size() < static_cast<size_t>(m_bulkFetchWindow))
+			{
+				auto remoteObject = m_bulkFetchPending.front();
+				m_bulkFetchPending.pop_front();
+
+				// objects already in flight are not polled twice
+				if (!m_bulkFetchInFlight.insert(std::make_tuple(remoteObject._Id, static_cast<std::int32_t>(remoteObject._Addr._first), static_cast<std::int32_t>(remoteObject._Addr._second))).second)
+					continue;
+				m_bulkFetchInFlightCount.set(static_cast<int>(m_bulkFetchInFlight.size()));
+
+				auto romd = RemoteObjectMessageData(remoteObject._Addr, ROVT_NONE, 0, nullptr, 0);
+				Controller::GetInstance()->SendMessageDataDirect(remoteObject._Id, romd);
+				CountPolls(1, 0);
+			}
+		}
+		void CountPolls(int sentCount, int skippedCount)
+		{
+			const ScopedLock l(m_pollCountLock);
+			m_sentPollCount += sentCount;
+			m_skippedPollCount += skippedCount;
+		}
+		void CheckBulkFetchTimeout()
+		{
+			const ScopedLock l(m_bulkFetchLock);
+			if (m_bulkFetchInFlight.empty() || juce::Time::getMillisecondCounter() - m_bulkFetchProgressTime < static_cast<juce::uint32>(m_bulkFetchTimeout))
+				return;
+
+			// values that were not received are left to regular polling
+			m_bulkFetchGivenUpCount++;
+			m_bulkFetchLastDuration = static_cast<int>(m_bulkFetchProgressTime - m_bulkFetchStartTime);
+			DBG(juce::String(__FUNCTION__) << " bulk fetch gave up on " << int(m_bulkFetchInFlight.size() + m_bulkFetchPending.size()) << " objects after " << m_bulkFetchLastDuration << "ms");
+			m_bulkFetchInFlight.clear();
+			m_bulkFetchInFlightCount.set(0);
+			m_bulkFetchPending.clear();
+		}
+		void PollSlot()
+		{
+			if (!Controller::GetInstance()->IsOnline())
+				return;
+
+			// queue all objects at the start of an interval, but only if the previous queue was sent completely,
+			// to stretch the interval instead of exceeding the poll rate budget
+			if (m_slotIdx == 0 && m_pollQueue.empty())
+			{
+				QueueObjectsToPoll();
+				m_pollsPerSlot = (m_pollQueue.size() + POLL_SLOT_COUNT - 1) / POLL_SLOT_COUNT;
+			}
+			m_slotIdx = (m_slotIdx + 1) % POLL_SLOT_COUNT;
+
+			auto pollBudget = static_cast<size_t>(std::max(1, POLL_RATE_BUDGET * GetSlotInterval() / 1000));
+			auto pollCount = std::min({ m_pollsPerSlot, pollBudget, m_pollQueue.size() });
+			for (size_t i = 0; i < pollCount; i++)
+			{
+				auto romd = RemoteObjectMessageData(m_pollQueue.front()._Addr, ROVT_NONE, 0, nullptr, 0);
+				Controller::GetInstance()->SendMessageDataDirect(m_pollQueue.front()._Id, romd);
+				m_pollQueue.pop_front();
+			}
+			CountPolls(static_cast<int>(pollCount), 0);
+		}
+		void QueueObjectsToPoll()
+		{
+			auto remoteObjectsToPoll = Controller::GetInstance()->GetAllStandaloneActiveRemoteObjectsToUse();
+
+			// only keep the backoff state of objects that are still registered
+			const ScopedLock l(m_pollBackoffLock);
+			auto pollBackoff = std::map<std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t>, PollBackoff>();
+			auto skippedCount = 0;
+			for (auto const& remoteObject : remoteObjectsToPoll)
+			{
+				auto key = std::make_tuple(remoteObject._Id, static_cast<std::int32_t>(remoteObject._Addr._first), static_cast<std::int32_t>(remoteObject._Addr._second));
+				auto backoffIter = m_pollBackoff.find(key);
+				auto backoff = (backoffIter != m_pollBackoff.end()) ? backoffIter->second : PollBackoff();
+				if (++backoff._intervalsSincePoll >= backoff._pollEvery)
+				{
+					m_pollQueue.push_back(remoteObject);
+					backoff._intervalsSincePoll = 0;
+					backoff._pollEvery = std::min(2 * backoff._pollEvery, POLL_BACKOFF_MAX);
+				}
+				else
+					skippedCount++;
+				pollBackoff[key] = std::move(backoff);
+			}
+			m_pollBackoff.swap(pollBackoff);
+			m_pollBackoffCount.set(static_cast<int>(m_pollBackoff.size()));
+			CountPolls(0, skippedCount);
 		}
 		void PollOnce()
 		{
@@ -372,11 +624,32 @@ private:
 					auto romd = RemoteObjectMessageData(remoteObject._Addr, ROVT_NONE, 0, nullptr, 0);
 					Controller::GetInstance()->SendMessageDataDirect(remoteObject._Id, romd);
 				}
+				CountPolls(static_cast<int>(remoteObjectsToPoll.size()), 0);
 			}
 		}
 
 		int m_interval{ 0 };
 		bool m_running{ false };
+		std::deque<RemoteObject> m_pollQueue;	/**< The objects still to be polled in the current interval. */
+		size_t m_pollsPerSlot{ 0 };				/**< The count of polls to send per slot in the current interval. */
+		int m_slotIdx{ 0 };						/**< The index of the next slot within the interval. */
+		std::map<std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t>, PollBackoff> m_pollBackoff;	/**< The polling backoff state per object and address. */
+		juce::CriticalSection m_pollBackoffLock;	/**< Lock for the backoff state, since received values are not necessarily handled on the timer thread. */
+		juce::Atomic<int> m_pollBackoffCount{ 0 };	/**< The count of objects with backoff state, to skip locking for received values when there is none. */
+		std::deque<RemoteObject> m_bulkFetchPending;	/**< The objects still to be polled in the current bulk fetch. */
+		std::set<std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t>> m_bulkFetchInFlight;	/**< The objects polled in the current bulk fetch, that no value was received for yet. */
+		juce::Atomic<int> m_bulkFetchInFlightCount{ 0 };	/**< The count of objects in m_bulkFetchInFlight, to skip locking for received values when no bulk fetch is in flight. */
+		juce::uint32 m_bulkFetchStartTime{ 0 };		/**< The time the current bulk fetch was started. */
+		juce::uint32 m_bulkFetchProgressTime{ 0 };	/**< The time a value was last received in the current bulk fetch. */
+		int m_bulkFetchWindow{ BULK_FETCH_WINDOW_DEF };		/**< The maximum count of bulk fetch polls in flight without a received value. */
+		int m_bulkFetchTimeout{ BULK_FETCH_TIMEOUT_DEF };	/**< The time in ms without a received value, after which a bulk fetch is given up. */
+		int m_bulkFetchCompletedCount{ 0 };			/**< The count of bulk fetches that received all values since start, for statistics. */
+		int m_bulkFetchGivenUpCount{ 0 };			/**< The count of bulk fetches given up due to missing values since start, for statistics. */
+		int m_bulkFetchLastDuration{ 0 };			/**< The time in ms from start to last received value of the latest completed or given up bulk fetch, for statistics. */
+		juce::CriticalSection m_bulkFetchLock;		/**< Lock for the bulk fetch state, since received values are not necessarily handled on the timer thread. */
+		int m_sentPollCount{ 0 };					/**< The count of polls sent since start, for statistics. */
+		int m_skippedPollCount{ 0 };				/**< The count of polls skipped due to backoff since start, for statistics. */
+		juce::CriticalSection m_pollCountLock;		/**< Lock for the poll counts, since bulk fetch polls are not necessarily sent on the timer thread. */
 	};
 
 	/**
@@ -452,6 +725,7 @@ private:
 	int								m_DS100Port;					/**< Port on the ds100 device to connect to. */
 	ExtensionMode					m_DS100ExtensionMode;			/**< Current extension mode. This has impact on if second DS100 is active or not. */
 	ActiveParallelModeDS100			m_DS100ActiveParallelModeDS100;	/**< Currently active DS100 when in extension mode "parallel". */
+	int								m_DS100MirrorFailoverTime;		/**< Time in ms after which the slave DS100 takes over when in extension mode "mirror". */
 	juce::IPAddress					m_SecondDS100IpAddress;			/**< IP Address where OSC messages will be sent to / received from. */
 	int								m_SecondDS100Port;				/**< Port on a second ds100 device to connect to. */
 	juce::String					m_DS100DummyProjectData;		/**< Dummy dbpr project data excerpt as string. */
@@ -464,9 +738,11 @@ private:
 
 	bool							m_staticProcessorRemoteObjectsPollingEnabled{ false };	/**< Member to define if static processor related objects should be regarded when polling/subscribing (usually object name strings). */
 
+	std::unique_ptr<LevelMeterPipeline>													m_levelMeterPipeline;				/**< Pipeline that collects matrix level meter values and commits them to the processors at ui rate. */
 	std::unique_ptr<StandaloneActiveObjectsPollingHelper>								m_pollingHelper;					/**< Polling helper instance for OSC DS100 communation. */
 	std::vector<Controller::StandaloneActiveObjectsListener*>							m_standaloneActiveObjectListeners;	/**< The listner objects, for message data handling callback. */
 	std::map<Controller::StandaloneActiveObjectsListener*, std::vector<RemoteObject>>	m_standaloneActiveRemoteObjects;	/**< List of remote objects that the controller manages as lowfreq apart from regular hifreq object value subscription/polling. */
+	std::map<std::tuple<RemoteObjectIdentifier, std::int32_t, std::int32_t>, std::vector<Controller::StandaloneActiveObjectsListener*>>	m_standaloneActiveRemoteObjectListeners;	/**< Index of the listeners that registered a standalone active remote object, per object and address, to dispatch incoming values without scanning all listeners' objects. */
 
 	bool m_tickProcessingRunning{ true };		/**< Boolean flag to indicate if the TickTrigger async handling shall be active. */
 	bool m_tickWasPostponedWhenPaused{ false };	/**< Boolean flag to indicate if while TickTrigger handling was paused a trigger was dropped and has to be compensated manually. */
@@ -272,6 +272,17 @@ void MatrixInputProcessorEditor::EnqueueTickTrigger()
 		postMessage(new TickTrigger());
 }
 
+/**
+ * Setter for the held peak level that is shown on the level meter.
+ * This is used by the level meter pipeline that takes care of decaying levels and peaks.
+ * @param peakLevel		The new peak level.
+ */
+void MatrixInputProcessorEditor::SetLevelMeterPeak(float peakLevel)
+{
+	if (m_MatrixInputLevelMeterSlider)
+		m_MatrixInputLevelMeterSlider->SetPeakValue(peakLevel);
+}
+
 /**
  * Update GUI elements with the current parameter values.
  */
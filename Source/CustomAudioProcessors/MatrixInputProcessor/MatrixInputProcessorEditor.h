@@ -47,6 +47,8 @@ public:
 	void UpdateGui();
 	void EnqueueTickTrigger();
 
+	void SetLevelMeterPeak(float peakLevel);
+
 private:
 	/**
 	 * Private message class to act as asynchronous
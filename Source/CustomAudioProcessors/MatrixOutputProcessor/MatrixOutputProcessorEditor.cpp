@@ -273,6 +273,17 @@ void MatrixOutputProcessorEditor::EnqueueTickTrigger()
 		postMessage(new TickTrigger());
 }
 
+/**
+ * Setter for the held peak level that is shown on the level meter.
+ * This is used by the level meter pipeline that takes care of decaying levels and peaks.
+ * @param peakLevel		The new peak level.
+ */
+void MatrixOutputProcessorEditor::SetLevelMeterPeak(float peakLevel)
+{
+	if (m_MatrixOutputLevelMeterSlider)
+		m_MatrixOutputLevelMeterSlider->SetPeakValue(peakLevel);
+}
+
 /**
  * Update GUI elements with the current parameter values.
  */
@@ -0,0 +1,314 @@
+/* Copyright (c) 2020-2023, Christian Ahrens
+ *
+ * This file is part of SpaConBridge <https://github.com/ChristianAhrens/SpaConBridge>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include "LevelMeterPipeline.h"
+
+#include "Controller.h"
+#include "CustomAudioProcessors/MatrixInputProcessor/MatrixInputProcessor.h"
+#include "CustomAudioProcessors/MatrixInputProcessor/MatrixInputProcessorEditor.h"
+#include "CustomAudioProcessors/MatrixOutputProcessor/MatrixOutputProcessor.h"
+#include "CustomAudioProcessors/MatrixOutputProcessor/MatrixOutputProcessorEditor.h"
+
+
+namespace SpaConBridge
+{
+
+
+/*
+===============================================================================
+ Struct LevelMeterPipeline::MeterChannels
+===============================================================================
+*/
+
+/**
+ * Constructor of the flat meter data struct. All channels are initialized to the range minimum.
+ * @param range		The value range of the meters.
+ */
+LevelMeterPipeline::MeterChannels::MeterChannels(const juce::Range<float>& range)
+	: _range(range),
+	_incoming(DS100_EXTMODE_CHANNELCOUNT, range.getStart()),
+	_incomingPending(DS100_EXTMODE_CHANNELCOUNT, false),
+	_target(DS100_EXTMODE_CHANNELCOUNT, range.getStart()),
+	_level(DS100_EXTMODE_CHANNELCOUNT, range.getStart()),
+	_peak(DS100_EXTMODE_CHANNELCOUNT, range.getStart()),
+	_peakHoldTicks(DS100_EXTMODE_CHANNELCOUNT, 0)
+{
+}
+
+/**
+ * Stores an incoming value for the given channel. If several values arrive within one
+ * ui tick, the highest one is kept, to not lose short peaks.
+ * @param channelId		The channel id (starting at 1).
+ * @param level			The incoming level value.
+ */
+void LevelMeterPipeline::MeterChannels::SetIncoming(int channelId, float level)
+{
+	auto idx = channelId - 1;
+	if (idx < 0 || idx >= DS100_EXTMODE_CHANNELCOUNT)
+		return;
+
+	if (!_incomingPending[idx] || level > _incoming[idx])
+		_incoming[idx] = _range.clipValue(level);
+	_incomingPending[idx] = true;
+}
+
+/**
+ * Getter for the decayed level of the given channel.
+ * @param channelId		The channel id (starting at 1).
+ * @return	The decayed level or the range minimum for invalid channel ids.
+ */
+float LevelMeterPipeline::MeterChannels::GetLevel(int channelId) const
+{
+	auto idx = channelId - 1;
+	if (idx < 0 || idx >= DS100_EXTMODE_CHANNELCOUNT)
+		return _range.getStart();
+
+	return _level[idx];
+}
+
+/**
+ * Getter for the held peak level of the given channel.
+ * @param channelId		The channel id (starting at 1).
+ * @return	The peak level or the range minimum for invalid channel ids.
+ */
+float LevelMeterPipeline::MeterChannels::GetPeak(int channelId) const
+{
+	auto idx = channelId - 1;
+	if (idx < 0 || idx >= DS100_EXTMODE_CHANNELCOUNT)
+		return _range.getStart();
+
+	return _peak[idx];
+}
+
+/**
+ * Advances all channels by one ui tick: the pending incoming values become the new
+ * targets, the levels rise to their targets immediately or fall by the decay step,
+ * and the peaks are held for the given count of ticks before they fall as well.
+ * @param decayStep		The value the levels fall per ui tick.
+ * @param peakHoldTicks	The count of ui ticks a new peak is held.
+ * @return	True if a value was received or any level or peak is still moving, false if all channels have settled.
+ */
+bool LevelMeterPipeline::MeterChannels::Decay(float decayStep, int peakHoldTicks)
+{
+	auto moving = false;
+
+	for (auto idx = 0; idx < DS100_EXTMODE_CHANNELCOUNT; idx++)
+	{
+		if (_incomingPending[idx])
+		{
+			_target[idx] = _incoming[idx];
+			_incomingPending[idx] = false;
+			moving = true;
+		}
+
+		auto level = std::max(_target[idx], _level[idx] - decayStep);
+		if (level != _level[idx])
+		{
+			_level[idx] = level;
+			moving = true;
+		}
+
+		if (_level[idx] >= _peak[idx])
+		{
+			if (_level[idx] != _peak[idx])
+				moving = true;
+			_peak[idx] = _level[idx];
+			_peakHoldTicks[idx] = peakHoldTicks;
+		}
+		else
+		{
+			if (_peakHoldTicks[idx] > 0)
+				_peakHoldTicks[idx]--;
+			else
+				_peak[idx] = std::max(_level[idx], _peak[idx] - decayStep);
+			moving = true;
+		}
+	}
+
+	return moving;
+}
+
+
+/*
+===============================================================================
+ Class LevelMeterPipeline
+===============================================================================
+*/
+
+/**
+ * Class constructor. The ui rate timer is only started once the first values arrive.
+ */
+LevelMeterPipeline::LevelMeterPipeline()
+	: m_matrixInputMeters(ProcessingEngineConfig::GetRemoteObjectRange(ROI_MatrixInput_LevelMeterPreMute)),
+	m_matrixOutputMeters(ProcessingEngineConfig::GetRemoteObjectRange(ROI_MatrixOutput_LevelMeterPostMute))
+{
+}
+
+/**
+ * Class destructor.
+ */
+LevelMeterPipeline::~LevelMeterPipeline()
+{
+	stopTimer();
+}
+
+/**
+ * Setter for an incoming matrix input level meter value.
+ * The value only reaches the processor with the next ui tick, the ui rate timer is started if it is idle.
+ * @param matrixInputId		The matrix input the value belongs to.
+ * @param level				The level meter value.
+ */
+void LevelMeterPipeline::SetMatrixInputLevel(MatrixInputId matrixInputId, float level)
+{
+	m_matrixInputMeters.SetIncoming(matrixInputId, level);
+
+	if (!isTimerRunning())
+		startTimer(UI_REFRESH_INTERVAL);
+}
+
+/**
+ * Setter for an incoming matrix output level meter value.
+ * The value only reaches the processor with the next ui tick, the ui rate timer is started if it is idle.
+ * @param matrixOutputId	The matrix output the value belongs to.
+ * @param level				The level meter value.
+ */
+void LevelMeterPipeline::SetMatrixOutputLevel(MatrixOutputId matrixOutputId, float level)
+{
+	m_matrixOutputMeters.SetIncoming(matrixOutputId, level);
+
+	if (!isTimerRunning())
+		startTimer(UI_REFRESH_INTERVAL);
+}
+
+/**
+ * Getter for the decayed level of a matrix input.
+ * @param matrixInputId		The matrix input to get the level for.
+ * @return	The decayed level.
+ */
+float LevelMeterPipeline::GetMatrixInputLevel(MatrixInputId matrixInputId) const
+{
+	return m_matrixInputMeters.GetLevel(matrixInputId);
+}
+
+/**
+ * Getter for the held peak level of a matrix input.
+ * @param matrixInputId		The matrix input to get the peak level for.
+ * @return	The peak level.
+ */
+float LevelMeterPipeline::GetMatrixInputPeakLevel(MatrixInputId matrixInputId) const
+{
+	return m_matrixInputMeters.GetPeak(matrixInputId);
+}
+
+/**
+ * Getter for the decayed level of a matrix output.
+ * @param matrixOutputId	The matrix output to get the level for.
+ * @return	The decayed level.
+ */
+float LevelMeterPipeline::GetMatrixOutputLevel(MatrixOutputId matrixOutputId) const
+{
+	return m_matrixOutputMeters.GetLevel(matrixOutputId);
+}
+
+/**
+ * Getter for the held peak level of a matrix output.
+ * @param matrixOutputId	The matrix output to get the peak level for.
+ * @return	The peak level.
+ */
+float LevelMeterPipeline::GetMatrixOutputPeakLevel(MatrixOutputId matrixOutputId) const
+{
+	return m_matrixOutputMeters.GetPeak(matrixOutputId);
+}
+
+/**
+ * Reimplemented from Timer to decay all meters and commit them to the processors at ui rate.
+ * Once no values arrive anymore and all meters have settled, there is nothing left to commit
+ * and the timer is stopped until the next value arrives.
+ */
+void LevelMeterPipeline::timerCallback()
+{
+	auto decayStep = DECAY_RATE_DBPERSEC * UI_REFRESH_INTERVAL / 1000.0f;
+	auto peakHoldTicks = PEAK_HOLD_TIME / UI_REFRESH_INTERVAL;
+
+	auto matrixInputsMoving = m_matrixInputMeters.Decay(decayStep, peakHoldTicks);
+	auto matrixOutputsMoving = m_matrixOutputMeters.Decay(decayStep, peakHoldTicks);
+	if (!matrixInputsMoving && !matrixOutputsMoving)
+	{
+		stopTimer();
+		return;
+	}
+
+	CommitMatrixInputLevels();
+	CommitMatrixOutputLevels();
+}
+
+/**
+ * Helper to commit the decayed levels to all matrix input processors in receive mode.
+ * Setting the parameter value enqueues the regular editor refresh, the peak level
+ * is only handed to the editor's meter, which repaints itself if it changed.
+ */
+void LevelMeterPipeline::CommitMatrixInputLevels()
+{
+	if (!Controller::Exists())
+		return;
+
+	for (auto const& processor : Controller::GetInstance()->GetMatrixInputProcessors())
+	{
+		if (!processor || ((processor->GetComsMode() & CM_Rx) != CM_Rx))
+			continue;
+
+		auto matrixInputId = processor->GetMatrixInputId();
+
+		if (auto editor = dynamic_cast<MatrixInputProcessorEditor*>(processor->getActiveEditor()))
+			editor->SetLevelMeterPeak(m_matrixInputMeters.GetPeak(matrixInputId));
+
+		auto level = m_matrixInputMeters.GetLevel(matrixInputId);
+		if (static_cast<int>(100.0f * level) != static_cast<int>(100.0f * processor->GetParameterValue(MII_ParamIdx_LevelMeterPreMute)))
+			processor->SetParameterValue(DCP_Protocol, MII_ParamIdx_LevelMeterPreMute, level);
+	}
+}
+
+/**
+ * Helper to commit the decayed levels to all matrix output processors in receive mode.
+ * Setting the parameter value enqueues the regular editor refresh, the peak level
+ * is only handed to the editor's meter, which repaints itself if it changed.
+ */
+void LevelMeterPipeline::CommitMatrixOutputLevels()
+{
+	if (!Controller::Exists())
+		return;
+
+	for (auto const& processor : Controller::GetInstance()->GetMatrixOutputProcessors())
+	{
+		if (!processor || ((processor->GetComsMode() & CM_Rx) != CM_Rx))
+			continue;
+
+		auto matrixOutputId = processor->GetMatrixOutputId();
+
+		if (auto editor = dynamic_cast<MatrixOutputProcessorEditor*>(processor->getActiveEditor()))
+			editor->SetLevelMeterPeak(m_matrixOutputMeters.GetPeak(matrixOutputId));
+
+		auto level = m_matrixOutputMeters.GetLevel(matrixOutputId);
+		if (static_cast<int>(100.0f * level) != static_cast<int>(100.0f * processor->GetParameterValue(MOI_ParamIdx_LevelMeterPostMute)))
+			processor->SetParameterValue(DCP_Protocol, MOI_ParamIdx_LevelMeterPostMute, level);
+	}
+}
+
+
+} // namespace SpaConBridge
@@ -0,0 +1,91 @@
+/* Copyright (c) 2020-2023, Christian Ahrens
+ *
+ * This file is part of SpaConBridge <https://github.com/ChristianAhrens/SpaConBridge>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "SpaConBridgeCommon.h"
+
+
+namespace SpaConBridge
+{
+
+
+/**
+ * Class LevelMeterPipeline collects incoming matrix input and output level meter values
+ * in flat per channel arrays, instead of having every single protocol message set the
+ * processor parameters and trigger gui updates. At a fixed ui rate, independent of
+ * the protocol rate, the values are decayed with peak hold and committed to the processors
+ * in one batched pass. The editors then pick the new values up through their regular refresh.
+ * The ui rate timer only runs while values arrive or the meters are still falling.
+ */
+class LevelMeterPipeline : private juce::Timer
+{
+public:
+	LevelMeterPipeline();
+	~LevelMeterPipeline() override;
+
+	void SetMatrixInputLevel(MatrixInputId matrixInputId, float level);
+	void SetMatrixOutputLevel(MatrixOutputId matrixOutputId, float level);
+
+	float GetMatrixInputLevel(MatrixInputId matrixInputId) const;
+	float GetMatrixInputPeakLevel(MatrixInputId matrixInputId) const;
+	float GetMatrixOutputLevel(MatrixOutputId matrixOutputId) const;
+	float GetMatrixOutputPeakLevel(MatrixOutputId matrixOutputId) const;
+
+	static constexpr int	UI_REFRESH_INTERVAL = 40;		//< Interval at which the meters are decayed and committed to ui, in ms.
+	static constexpr float	DECAY_RATE_DBPERSEC = 24.0f;	//< Rate at which the meters fall when no higher value arrives, in dB/s.
+	static constexpr int	PEAK_HOLD_TIME = 1500;			//< Time the peak level is held before it falls, in ms.
+
+private:
+	/**
+	 * Flat per channel meter data, indexed by (channel id - 1).
+	 */
+	struct MeterChannels
+	{
+		explicit MeterChannels(const juce::Range<float>& range);
+
+		void SetIncoming(int channelId, float level);
+		float GetLevel(int channelId) const;
+		float GetPeak(int channelId) const;
+		bool Decay(float decayStep, int peakHoldTicks);
+
+		juce::Range<float>	_range;				/**< The value range of the meters. */
+		std::vector<float>	_incoming;			/**< Highest value received per channel since the last ui tick. */
+		std::vector<bool>	_incomingPending;	/**< Flag per channel if a value was received since the last ui tick. */
+		std::vector<float>	_target;			/**< Last received value per channel. */
+		std::vector<float>	_level;				/**< Decayed level per channel, as shown on ui. */
+		std::vector<float>	_peak;				/**< Held peak level per channel, as shown on ui. */
+		std::vector<int>	_peakHoldTicks;		/**< Remaining ui ticks per channel the peak level is held. */
+	};
+
+	void timerCallback() override;
+
+	void CommitMatrixInputLevels();
+	void CommitMatrixOutputLevels();
+
+	MeterChannels	m_matrixInputMeters;	/**< Meter data of all matrix inputs. */
+	MeterChannels	m_matrixOutputMeters;	/**< Meter data of all matrix outputs. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeterPipeline)
+};
+
+
+} // namespace SpaConBridge
@@ -92,5 +92,35 @@ void LevelMeterSlider::mouseUp(const MouseEvent& e)
 		return Slider::mouseUp(e);
 }
 
+/**
+ * Setter for the held peak value, that is drawn as marker on top of the meter bar.
+ * Only triggers a repaint if the value actually changed.
+ * @param peakValue		The new peak value.
+ */
+void LevelMeterSlider::SetPeakValue(double peakValue)
+{
+	if (m_peakValue != peakValue)
+	{
+		m_peakValue = peakValue;
+		repaint();
+	}
+}
+
+/**
+ * Reimplemented from Slider to additionally draw the peak value marker.
+ * @param g		The graphics context to use for drawing.
+ */
+void LevelMeterSlider::paint(Graphics& g)
+{
+	Slider::paint(g);
+
+	if (m_peakValue > getMinimum() && m_peakValue <= getMaximum())
+	{
+		auto peakPos = getPositionOfValue(m_peakValue);
+		g.setColour(findColour(Slider::ColourIds::trackColourId).brighter());
+		g.fillRect(juce::Rectangle<float>(peakPos - 1.0f, 0.0f, 2.0f, static_cast<float>(getHeight())));
+	}
+}
+
 
 } // namespace SpaConBridge
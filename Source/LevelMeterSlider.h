@@ -47,8 +47,13 @@ public:
 	void mouseDrag (const MouseEvent& e) override;
 	void mouseUp (const MouseEvent& e) override;
 
+	void SetPeakValue(double peakValue);
+
+	void paint(Graphics& g) override;
+
 private:
-	LevelMeterMode m_levelMeterMode{ LMM_Invalid };
+	LevelMeterMode	m_levelMeterMode{ LMM_Invalid };
+	double			m_peakValue{ 0.0 };	/**< The held peak value that is drawn as marker on top of the meter bar. */
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LevelMeterSlider)
 };
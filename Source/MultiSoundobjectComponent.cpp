@@ -118,6 +118,9 @@ MultiSoundobjectComponent::MultiSoundobjectComponent()
  */
 MultiSoundobjectComponent::~MultiSoundobjectComponent()
 {
+	if (m_visuParamSnapshotDirty)
+		SaveVisualizationParameterDataSnapshot();
+
 	if (Controller::Exists())
 	{
 		auto const ctrl = Controller::GetInstance();
@@ -748,6 +751,64 @@ void MultiSoundobjectComponent::HandleObjectDataInternal(const RemoteObjectIdent
 	if (!m_multiSoundobjectSlider)
 		return;
 
+	ApplyVisualizationParameterData(roi, msgData);
+
+	// remember the value for the next warm start
+	auto key = std::make_pair(roi, static_cast<int>(msgData._addrVal._first));
+	auto& snapshotValue = m_visuParamSnapshot[key];
+	if (snapshotValue._valType != msgData._valType || snapshotValue._valCount != msgData._valCount || !snapshotValue._payload.matches(msgData._payload, msgData._payloadSize))
+	{
+		snapshotValue._valType = msgData._valType;
+		snapshotValue._valCount = msgData._valCount;
+		snapshotValue._payload.replaceAll(msgData._payload, msgData._payloadSize);
+
+		// debounce writing the changed value to file, to not write once per received value
+		m_visuParamSnapshotDirty = true;
+		startTimer(VISUDATA_SNAPSHOT_SAVEDELAY);
+	}
+	m_visuParamReceivedFromDevice.insert(key);
+
+	if (UpdateVisualizationParameterDataReadyState())
+	{
+		RemoveRequiredActiveObjects();
+		SaveVisualizationParameterDataSnapshot();
+
+		UpdateGui(true);
+	}
+	else if (m_visuParamReadyFromSnapshot)
+	{
+		// the visualization already is ready from the snapshot, so wait for all values to be reconciled with device
+		auto mappingAreaCount = int(MAI_Fourth) - int(MAI_First) + 1;
+		auto requiredObjectCount = static_cast<size_t>(8 * mappingAreaCount + DS100_CHANNELCOUNT);
+		if (m_visuParamReceivedFromDevice.size() >= requiredObjectCount)
+		{
+			DBG(juce::String(__FUNCTION__) + " CoordinateMappingSettings and SpeakerPosition data from snapshot is now reconciled with device.");
+
+			m_visuParamReadyFromSnapshot = false;
+
+			RemoveRequiredActiveObjects();
+			SaveVisualizationParameterDataSnapshot();
+
+			UpdateGui(true);
+		}
+	}
+}
+
+/**
+ * Reimplemented from Timer to write the snapshot file once no changed values arrived for the debounce delay.
+ */
+void MultiSoundobjectComponent::timerCallback()
+{
+	SaveVisualizationParameterDataSnapshot();
+}
+
+/**
+ * Helper method to insert a speaker position or coordinate mapping settings value into the multi-slider.
+ * @param	roi			The roi of the value.
+ * @param	msgData		The object message value data.
+ */
+void MultiSoundobjectComponent::ApplyVisualizationParameterData(const RemoteObjectIdentifier& roi, const RemoteObjectMessageData& msgData)
+{
 	auto channel = msgData._addrVal._first;
 	auto mappingAreaId = static_cast<MappingAreaId>(channel);
 
@@ -828,8 +889,15 @@ void MultiSoundobjectComponent::HandleObjectDataInternal(const RemoteObjectIdent
 		jassertfalse;
 		break;
 	}
+}
 
-
+/**
+ * Helper method to set the multi-slider's data ready states, if the coordinate mapping settings
+ * and speaker position data is complete.
+ * @return	True if the data just became completely ready, false if it is not or already was before.
+ */
+bool MultiSoundobjectComponent::UpdateVisualizationParameterDataReadyState()
+{
 	bool coordinateMappingsSettingsDataReadyChanged = false;
 	if (m_multiSoundobjectSlider->CheckCoordinateMappingSettingsDataCompleteness() && !m_multiSoundobjectSlider->IsCoordinateMappingsSettingsDataReady())
 	{
@@ -850,10 +918,140 @@ void MultiSoundobjectComponent::HandleObjectDataInternal(const RemoteObjectIdent
 		&& (coordinateMappingsSettingsDataReadyChanged || speakerPositionDataReadyChanged))
 	{
 		DBG(juce::String(__FUNCTION__) + " we now have the required CoordinateMappingSettings and SpeakerPosition data at hand to do fancy stuff.");
+		return true;
+	}
 
-		RemoveRequiredActiveObjects();
+	return false;
+}
 
-		UpdateGui(true);
+/**
+ * Helper method to get the file the last known speaker position and coordinate mapping settings values
+ * are persisted in. The file is specific to the first DS100's ip address, to not show values of another device.
+ * @return	The snapshot file.
+ */
+juce::File MultiSoundobjectComponent::GetVisualizationParameterDataSnapshotFile()
+{
+	auto ds100Identity = juce::String("default");
+	auto const ctrl = Controller::GetInstance();
+	if (ctrl)
+		ds100Identity = ctrl->GetDS100IpAndPort().first.toString().replaceCharacters(".:", "__");
+
+	auto configDirectory = juce::File(JUCEAppBasics::AppConfigurationBase::getDefaultConfigFilePath()).getParentDirectory();
+	return configDirectory.getChildFile("DS100VisuData_" + ds100Identity + ".bin");
+}
+
+/**
+ * Helper method to read the last known speaker position and coordinate mapping settings values from file
+ * and insert them into the multi-slider, to have the visualization ready right away, before the values
+ * are reconciled with the device.
+ */
+void MultiSoundobjectComponent::LoadVisualizationParameterDataSnapshot()
+{
+	// pending changes may belong to another device than the current snapshot file, they are received again anyway
+	stopTimer();
+	m_visuParamSnapshotDirty = false;
+
+	m_visuParamSnapshot.clear();
+	m_visuParamReadyFromSnapshot = false;
+
+	if (!m_multiSoundobjectSlider)
+		return;
+
+	auto snapshotStream = GetVisualizationParameterDataSnapshotFile().createInputStream();
+	if (!snapshotStream || snapshotStream->readInt() != VISUDATA_SNAPSHOT_VERSION)
+		return;
+
+	// read and verify all values first, to not apply anything from a corrupt or outdated snapshot
+	auto snapshot = std::map<std::pair<RemoteObjectIdentifier, int>, VisualizationParameterValue>();
+	auto valueCount = snapshotStream->readInt();
+	for (auto i = 0; i < valueCount; i++)
+	{
+		auto roi = static_cast<RemoteObjectIdentifier>(snapshotStream->readInt());
+		auto channel = snapshotStream->readInt();
+		auto& snapshotValue = snapshot[std::make_pair(roi, channel)];
+		snapshotValue._valType = static_cast<RemoteObjectValueType>(snapshotStream->readInt());
+		snapshotValue._valCount = snapshotStream->readInt();
+		auto payloadSize = snapshotStream->readInt();
+		if (!IsVisualizationParameterObject(roi, channel) || payloadSize < 0 || payloadSize > VISUDATA_SNAPSHOT_MAXPAYLOADSIZE
+			|| snapshotStream->readIntoMemoryBlock(snapshotValue._payload, payloadSize) != static_cast<size_t>(payloadSize))
+		{
+			DBG(juce::String(__FUNCTION__) + " discarding invalid snapshot " + GetVisualizationParameterDataSnapshotFile().getFullPathName());
+			return;
+		}
+	}
+
+	m_visuParamSnapshot.swap(snapshot);
+	for (auto const& snapshotValueKV : m_visuParamSnapshot)
+	{
+		RemoteObjectMessageData msgData;
+		msgData._addrVal._first = static_cast<ChannelId>(snapshotValueKV.first.second);
+		msgData._addrVal._second = INVALID_ADDRESS_VALUE;
+		msgData._valType = snapshotValueKV.second._valType;
+		msgData._valCount = static_cast<decltype(msgData._valCount)>(snapshotValueKV.second._valCount);
+		msgData._payload = const_cast<void*>(snapshotValueKV.second._payload.getData());
+		msgData._payloadSize = static_cast<decltype(msgData._payloadSize)>(snapshotValueKV.second._payload.getSize());
+		ApplyVisualizationParameterData(snapshotValueKV.first.first, msgData);
+	}
+
+	if (UpdateVisualizationParameterDataReadyState())
+	{
+		m_visuParamReadyFromSnapshot = true;
+		m_multiSoundobjectSlider->repaint();
+	}
+}
+
+/**
+ * Helper method to check if an object read from snapshot file is one of the speaker position
+ * or coordinate mapping settings values the multi-slider uses, on a valid channel or mapping area.
+ * @param	roi		The roi of the value.
+ * @param	channel	The channel or mapping area of the value.
+ * @return	True if the object is a valid visualization parameter, false if not.
+ */
+bool MultiSoundobjectComponent::IsVisualizationParameterObject(const RemoteObjectIdentifier roi, int channel)
+{
+	switch (roi)
+	{
+	case ROI_CoordinateMappingSettings_P1real:
+	case ROI_CoordinateMappingSettings_P2real:
+	case ROI_CoordinateMappingSettings_P3real:
+	case ROI_CoordinateMappingSettings_P4real:
+	case ROI_CoordinateMappingSettings_P1virtual:
+	case ROI_CoordinateMappingSettings_P3virtual:
+	case ROI_CoordinateMappingSettings_Flip:
+	case ROI_CoordinateMappingSettings_Name:
+		return channel >= int(MAI_First) && channel <= int(MAI_Fourth);
+	case ROI_Positioning_SpeakerPosition:
+		return channel >= 1 && channel <= DS100_CHANNELCOUNT;
+	default:
+		return false;
+	}
+}
+
+/**
+ * Helper method to write the last known speaker position and coordinate mapping settings values to file.
+ */
+void MultiSoundobjectComponent::SaveVisualizationParameterDataSnapshot()
+{
+	stopTimer();
+	m_visuParamSnapshotDirty = false;
+
+	auto snapshotFile = GetVisualizationParameterDataSnapshotFile();
+	snapshotFile.deleteFile();
+
+	auto snapshotStream = snapshotFile.createOutputStream();
+	if (!snapshotStream)
+		return;
+
+	snapshotStream->writeInt(VISUDATA_SNAPSHOT_VERSION);
+	snapshotStream->writeInt(static_cast<int>(m_visuParamSnapshot.size()));
+	for (auto const& snapshotValue : m_visuParamSnapshot)
+	{
+		snapshotStream->writeInt(static_cast<int>(snapshotValue.first.first));
+		snapshotStream->writeInt(snapshotValue.first.second);
+		snapshotStream->writeInt(static_cast<int>(snapshotValue.second._valType));
+		snapshotStream->writeInt(snapshotValue.second._valCount);
+		snapshotStream->writeInt(static_cast<int>(snapshotValue.second._payload.getSize()));
+		snapshotStream->write(snapshotValue.second._payload.getData(), snapshotValue.second._payload.getSize());
 	}
 }
 
@@ -863,6 +1061,10 @@ void MultiSoundobjectComponent::HandleObjectDataInternal(const RemoteObjectIdent
  */
 void MultiSoundobjectComponent::AddRequiredActiveObjects()
 {
+	// show the last known values right away, until they are reconciled with the device
+	m_visuParamReceivedFromDevice.clear();
+	LoadVisualizationParameterDataSnapshot();
+
 	auto const ctrl = Controller::GetInstance();
 	if (ctrl)
 	{
@@ -39,7 +39,8 @@ class SelectGroupSelector;
 class MultiSoundobjectComponent :	public Component,
 									public ComboBox::Listener,
 									public ToggleButton::Listener,
-									public Controller::StandaloneActiveObjectsListener
+									public Controller::StandaloneActiveObjectsListener,
+									private Timer
 {
 public:
 	MultiSoundobjectComponent();
@@ -75,6 +76,18 @@ private:
 	void AddRequiredActiveObjects();
 	void RemoveRequiredActiveObjects();
 
+	//==============================================================================
+	static constexpr int VISUDATA_SNAPSHOT_VERSION = 1;	//< Version of the speaker position and coordinate mapping settings snapshot file format.
+	static constexpr int VISUDATA_SNAPSHOT_MAXPAYLOADSIZE = 1024;	//< Maximum payload size of a single value in the snapshot file, to reject corrupt files.
+	static constexpr int VISUDATA_SNAPSHOT_SAVEDELAY = 2000;	//< Delay after the last changed value before the snapshot file is written, in ms.
+
+	void ApplyVisualizationParameterData(const RemoteObjectIdentifier& roi, const RemoteObjectMessageData& msgData);
+	bool UpdateVisualizationParameterDataReadyState();
+	juce::File GetVisualizationParameterDataSnapshotFile();
+	static bool IsVisualizationParameterObject(const RemoteObjectIdentifier roi, int channel);
+	void LoadVisualizationParameterDataSnapshot();
+	void SaveVisualizationParameterDataSnapshot();
+
 	//==============================================================================
 	void paint(Graphics&) override;
 	void resized() override;
@@ -88,6 +101,9 @@ private:
 	//==============================================================================
 	void HandleObjectDataInternal(const RemoteObjectIdentifier& roi, const RemoteObjectMessageData& msgData) override;
 
+	//==============================================================================
+	void timerCallback() override;
+
 	//==============================================================================
 	std::unique_ptr<MultiSoundobjectSlider>	m_multiSoundobjectSlider;	/**> Multi-source 2D-Slider. */
 
@@ -106,6 +122,20 @@ private:
 
 	std::unique_ptr<DrawableButton>			m_spreadEnable;				/**> Checkbox for spread factor enable. */
 
+	/**
+	 * A speaker position or coordinate mapping settings value as received from device.
+	 */
+	struct VisualizationParameterValue
+	{
+		RemoteObjectValueType	_valType{ ROVT_NONE };	/**< The value type. */
+		int						_valCount{ 0 };			/**< The count of values. */
+		juce::MemoryBlock		_payload;				/**< The value payload. */
+	};
+	std::map<std::pair<RemoteObjectIdentifier, int>, VisualizationParameterValue>	m_visuParamSnapshot;			/**> Last known speaker position and coordinate mapping settings values per object and channel, persisted for a warm start. */
+	std::set<std::pair<RemoteObjectIdentifier, int>>								m_visuParamReceivedFromDevice;	/**> Objects received from device since the values were last requested. */
+	bool																			m_visuParamReadyFromSnapshot{ false };	/**> Flag if the visualization was made ready from the snapshot and still waits for the values from device. */
+	bool																			m_visuParamSnapshotDirty{ false };		/**> Flag if the snapshot holds changed values that are not yet written to file. */
+
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultiSoundobjectComponent)
 };
@@ -1435,23 +1435,23 @@ void MultiSoundobjectSlider::applyObjectsRotAndScale(const std::vector<Soundobje
     auto scalingMatrix = AffineTransform::scale(scaling, scaling, relCOG.getX(), relCOG.getY());
     auto rotationMatrix = AffineTransform::rotation(rotation, relCOG.getX(), relCOG.getY());
 
-    auto updatedScreenCoords = std::vector<juce::Point<float>>();
-    for (auto const& objectId : objectIds)
+    transformObjectsStartPositions(objectIds, scalingMatrix.followedBy(rotationMatrix));
+
+    for (auto i = size_t(0); i < m_objectPosMultiEditIds.size(); i++)
     {
-        auto processor = ctrl->GetSoundobjectProcessor(objectId);
+        auto processor = ctrl->GetSoundobjectProcessor(m_objectPosMultiEditIds.at(i));
         if (processor)
         {
-            auto const& cachedPos = m_objectPosMultiEditStartValues.at(objectId);
-
-            auto newPos = cachedPos.transformedBy(scalingMatrix).transformedBy(rotationMatrix);
-            
-            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_X, newPos.getX());
-            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_Y, newPos.getY());
-
-            updatedScreenCoords.push_back(juce::Point<float>(newPos.getX() * w, h - (newPos.getY() * h)));
+            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_X, m_objectPosMultiEditX.at(i));
+            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_Y, m_objectPosMultiEditY.at(i));
         }
     }
 
+    auto updatedScreenCoords = std::vector<juce::Point<float>>();
+    updatedScreenCoords.reserve(m_objectPosMultiEditIds.size());
+    for (auto i = size_t(0); i < m_objectPosMultiEditIds.size(); i++)
+        updatedScreenCoords.push_back(juce::Point<float>(m_objectPosMultiEditX.at(i) * w, h - (m_objectPosMultiEditY.at(i) * h)));
+
     if (m_multiselectionVisualizer)
         m_multiselectionVisualizer->UpdateSelectionPoints(updatedScreenCoords);
 }
@@ -1479,7 +1479,6 @@ void MultiSoundobjectSlider::finalizeObjectsRotAndScale(const std::vector<Soundo
     auto scalingMatrix = AffineTransform::scale(scaling, scaling, relCOG.getX(), relCOG.getY());
     auto rotationMatrix = AffineTransform::rotation(rotation, relCOG.getX(), relCOG.getY());
 
-    auto updatedScreenCoords = std::vector<juce::Point<float>>();
     for (auto const& objectId : objectIds)
     {
         auto processor = ctrl->GetSoundobjectProcessor(objectId);
@@ -1492,22 +1491,83 @@ void MultiSoundobjectSlider::finalizeObjectsRotAndScale(const std::vector<Soundo
             param = dynamic_cast<GestureManagedAudioParameterFloat*>(processor->getParameters()[SPI_ParamIdx_Y]);
             if (param)
                 param->EndGuiGesture();
+        }
+    }
 
-            auto const& cachedPos = m_objectPosMultiEditStartValues.at(objectId);
-
-            auto newPos = cachedPos.transformedBy(scalingMatrix).transformedBy(rotationMatrix);
-
-            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_X, newPos.getX());
-            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_Y, newPos.getY());
+    transformObjectsStartPositions(objectIds, scalingMatrix.followedBy(rotationMatrix));
 
-            updatedScreenCoords.push_back(juce::Point<float>(newPos.getX() * w, h - (newPos.getY() * h)));
+    for (auto i = size_t(0); i < m_objectPosMultiEditIds.size(); i++)
+    {
+        auto processor = ctrl->GetSoundobjectProcessor(m_objectPosMultiEditIds.at(i));
+        if (processor)
+        {
+            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_X, m_objectPosMultiEditX.at(i));
+            processor->SetParameterValue(DCP_MultiSlider, SPI_ParamIdx_Y, m_objectPosMultiEditY.at(i));
         }
     }
 
+    auto updatedScreenCoords = std::vector<juce::Point<float>>();
+    updatedScreenCoords.reserve(m_objectPosMultiEditIds.size());
+    for (auto i = size_t(0); i < m_objectPosMultiEditIds.size(); i++)
+        updatedScreenCoords.push_back(juce::Point<float>(m_objectPosMultiEditX.at(i) * w, h - (m_objectPosMultiEditY.at(i) * h)));
+
     if (m_multiselectionVisualizer)
         m_multiselectionVisualizer->UpdateSelectionPoints(updatedScreenCoords);
 
     m_objectPosMultiEditStartValues.clear();
+    m_objectPosMultiEditIds.clear();
+    m_objectPosMultiEditX.clear();
+    m_objectPosMultiEditY.clear();
+    m_objectPosMultiEditStartX.clear();
+}
+
+/**
+ * Helper to apply an affine transform to the cached start positions of multiple soundobjects in one go.
+ * The start positions are gathered into structure-of-arrays x/y buffers that are then transformed
+ * by vectorized operations (x' = m00*x + m01*y + m02, y' = m10*x + m11*y + m12), leaving the
+ * results in m_objectPosMultiEditIds/m_objectPosMultiEditX/m_objectPosMultiEditY.
+ * The buffers, including the copy of the untransformed x positions, are members to not reallocate them on every gesture frame.
+ * @param   objectIds           The ids of the soundobjects whose cached start positions shall be transformed
+ * @param   transform           The transform to apply
+ */
+void MultiSoundobjectSlider::transformObjectsStartPositions(const std::vector<SoundobjectProcessorId>& objectIds, const juce::AffineTransform& transform)
+{
+    m_objectPosMultiEditIds.clear();
+    m_objectPosMultiEditX.clear();
+    m_objectPosMultiEditY.clear();
+    m_objectPosMultiEditIds.reserve(objectIds.size());
+    m_objectPosMultiEditX.reserve(objectIds.size());
+    m_objectPosMultiEditY.reserve(objectIds.size());
+    m_objectPosMultiEditStartX.reserve(objectIds.size());
+
+    for (auto const& objectId : objectIds)
+    {
+        auto cachedPosIter = m_objectPosMultiEditStartValues.find(objectId);
+        if (cachedPosIter == m_objectPosMultiEditStartValues.end())
+            continue;
+
+        m_objectPosMultiEditIds.push_back(objectId);
+        m_objectPosMultiEditX.push_back(cachedPosIter->second.getX());
+        m_objectPosMultiEditY.push_back(cachedPosIter->second.getY());
+    }
+
+    auto count = static_cast<int>(m_objectPosMultiEditIds.size());
+    if (count == 0)
+        return;
+
+    m_objectPosMultiEditStartX.assign(m_objectPosMultiEditX.begin(), m_objectPosMultiEditX.end());
+    auto xData = m_objectPosMultiEditX.data();
+    auto yData = m_objectPosMultiEditY.data();
+
+    // x' = m00 * x + m01 * y + m02
+    juce::FloatVectorOperations::multiply(xData, transform.mat00, count);
+    juce::FloatVectorOperations::addWithMultiply(xData, yData, transform.mat01, count);
+    juce::FloatVectorOperations::add(xData, transform.mat02, count);
+
+    // y' = m10 * x + m11 * y + m12 (using the untransformed x values)
+    juce::FloatVectorOperations::multiply(yData, transform.mat11, count);
+    juce::FloatVectorOperations::addWithMultiply(yData, m_objectPosMultiEditStartX.data(), transform.mat10, count);
+    juce::FloatVectorOperations::add(yData, transform.mat12, count);
 }
 
 /**
@@ -183,6 +183,7 @@ private:
 	void finalizeObjectsXYPos(const std::vector<SoundobjectProcessorId>& objectIds, const juce::Point<int>& positionMoveDelta);
 	void applyObjectsRotAndScale(const std::vector<SoundobjectProcessorId>& objectIds, const juce::Point<float>& cog, const float rotation, const float scaling);
 	void finalizeObjectsRotAndScale(const std::vector<SoundobjectProcessorId>& objectIds, const juce::Point<float>& cog, const float rotation, const float scaling);
+	void transformObjectsStartPositions(const std::vector<SoundobjectProcessorId>& objectIds, const juce::AffineTransform& transform);
 
 	//==============================================================================
 	void ComputeRealBoundingRect();
@@ -219,6 +220,10 @@ private:
     MultiTouchDirectionTarget                                   m_multiTouchTargetOperation{ MTDT_PendingInputDecision };   /**< Enum value defining how current multitouch input is interpreted. */
     std::map<SoundobjectProcessorId, float>                     m_multiTouchModNormalValues;								/**< Startvalues for multitouch multi-object modification, to be used as base for adding gesture deltas to create actual object values. */
 	std::map<SoundobjectProcessorId, juce::Point<float>>		m_objectPosMultiEditStartValues;							/**< Startvalues for editing multiple SO positions. */
+	std::vector<SoundobjectProcessorId>							m_objectPosMultiEditIds;									/**< Ids of the SOs currently being transformed, in the same order as the x/y transform buffers. */
+	std::vector<float>											m_objectPosMultiEditX;										/**< Structure-of-arrays buffer for the x positions of SOs currently being transformed. */
+	std::vector<float>											m_objectPosMultiEditY;										/**< Structure-of-arrays buffer for the y positions of SOs currently being transformed. */
+	std::vector<float>											m_objectPosMultiEditStartX;									/**< Copy of the untransformed x positions, needed while transforming the y positions. */
 
 	std::unique_ptr<MultiSOSelectionVisualizerComponent>		m_multiselectionVisualizer;									/**< Helper component to do the painting and user interaction tracking for multiselection interaction. */
 	
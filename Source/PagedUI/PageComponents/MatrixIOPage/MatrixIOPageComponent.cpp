@@ -282,11 +282,17 @@ void MatrixIOPageComponent::UpdateGui(bool init)
 
 	if (m_inputsComponent)
 	{
-		if (ctrl->PopParameterChanged(DCP_MatrixInputTable, DCT_NumProcessors) || init)
+		auto numProcessorsChanged = ctrl->PopParameterChanged(DCP_MatrixInputTable, DCT_NumProcessors);
+		if (init)
 		{
 			m_inputsComponent->RecreateTableRowIds();
 			m_inputsComponent->UpdateTable();
 		}
+		else if (numProcessorsChanged)
+		{
+			m_inputsComponent->UpdateTableRowIds();
+			m_inputsComponent->UpdateTable();
+		}
 		else if (ctrl->PopParameterChanged(DCP_MatrixInputTable, DCT_ProcessorSelection) ||
 			ctrl->PopParameterChanged(DCP_MatrixInputTable, DCT_BridgingConfig))
 		{
@@ -295,24 +301,33 @@ void MatrixIOPageComponent::UpdateGui(bool init)
 		else
 		{
 			// Iterate through all procssor instances and see if anything changed there.
+			// All change flags are popped, but the table is refreshed only once, since
+			// a refresh covers all visible rows anyway.
+			auto processorConfigChanged = false;
 			for (auto const& processorId : ctrl->GetMatrixInputProcessorIds())
 			{
 				auto processor = ctrl->GetMatrixInputProcessor(processorId);
 				if (processor && processor->PopParameterChanged(DCP_MatrixInputTable, DCT_MatrixInputProcessorConfig))
-				{
-					m_inputsComponent->UpdateTable();
-				}
+					processorConfigChanged = true;
 			}
+			if (processorConfigChanged)
+				m_inputsComponent->UpdateTable();
 		}
 	}
 
 	if (m_outputsComponent)
 	{
-		if (ctrl->PopParameterChanged(DCP_MatrixOutputTable, DCT_NumProcessors) || init)
+		auto numProcessorsChanged = ctrl->PopParameterChanged(DCP_MatrixOutputTable, DCT_NumProcessors);
+		if (init)
 		{
 			m_outputsComponent->RecreateTableRowIds();
 			m_outputsComponent->UpdateTable();
 		}
+		else if (numProcessorsChanged)
+		{
+			m_outputsComponent->UpdateTableRowIds();
+			m_outputsComponent->UpdateTable();
+		}
 		else if (ctrl->PopParameterChanged(DCP_MatrixOutputTable, DCT_ProcessorSelection) ||
 			ctrl->PopParameterChanged(DCP_MatrixOutputTable, DCT_BridgingConfig))
 		{
@@ -321,14 +336,17 @@ void MatrixIOPageComponent::UpdateGui(bool init)
 		else
 		{
 			// Iterate through all procssor instances and see if anything changed there.
+			// All change flags are popped, but the table is refreshed only once, since
+			// a refresh covers all visible rows anyway.
+			auto processorConfigChanged = false;
 			for (auto const& processorId : ctrl->GetMatrixOutputProcessorIds())
 			{
 				auto processor = ctrl->GetMatrixOutputProcessor(processorId);
 				if (processor && processor->PopParameterChanged(DCP_MatrixOutputTable, DCT_MatrixOutputProcessorConfig))
-				{
-					m_outputsComponent->UpdateTable();
-				}
+					processorConfigChanged = true;
 			}
+			if (processorConfigChanged)
+				m_outputsComponent->UpdateTable();
 		}
 	}
 }
@@ -53,6 +53,7 @@ SettingsSectionsComponent::SettingsSectionsComponent()
 {
 	// TextEditor input filters to be used for different editors
 	m_intervalEditFilter = std::make_unique<TextEditor::LengthAndCharacterRestriction>(7, "1234567890"); // 7 digits: "9999 ms"
+	m_failoverTimeEditFilter = std::make_unique<TextEditor::LengthAndCharacterRestriction>(8, "1234567890"); // 8 digits: "10000 ms"
 	m_ipAddressEditFilter = std::make_unique<TextEditor::LengthAndCharacterRestriction>(21, "1234567890.:"); // 21 digits: "255.255.255.255:65535"
 	m_portEditFilter = std::make_unique<TextEditor::LengthAndCharacterRestriction>(5, "1234567890"); // 5 digits: "65535"
 	m_mappingEditFilter = std::make_unique<TextEditor::LengthAndCharacterRestriction>(1, "1234"); // 1 digit: "4"
@@ -238,6 +239,15 @@ void SettingsSectionsComponent::createDS100SettingsSection()
 	m_DS100Settings->addComponent(m_SecondDS100ParallelModeLabel.get(), false, false);
 	m_DS100Settings->addComponent(m_SecondDS100ParallelModeButton.get(), true, false);
 
+	m_SecondDS100MirrorFailoverTimeEdit = std::make_unique<JUCEAppBasics::FixedFontTextEditor>();
+	m_SecondDS100MirrorFailoverTimeEdit->addListener(this);
+	m_SecondDS100MirrorFailoverTimeEdit->setInputFilter(m_failoverTimeEditFilter.get(), false);
+	m_SecondDS100MirrorFailoverTimeLabel = std::make_unique<Label>("SecondDS100MirrorFailoverTimeEdit", "Failover Time");
+	m_SecondDS100MirrorFailoverTimeLabel->setJustificationType(Justification::centred);
+	m_SecondDS100MirrorFailoverTimeLabel->attachToComponent(m_SecondDS100MirrorFailoverTimeEdit.get(), true);
+	m_DS100Settings->addComponent(m_SecondDS100MirrorFailoverTimeLabel.get(), false, false);
+	m_DS100Settings->addComponent(m_SecondDS100MirrorFailoverTimeEdit.get(), true, false);
+
 	//second DS100 - ch. 65-128
 	m_SecondDS100ConnectionElmsContainer = std::make_unique<HorizontalLayouterComponent>();
 	m_SecondDS100ConnectionElmsContainer->SetSpacing(5);
@@ -1319,6 +1329,8 @@ void SettingsSectionsComponent::textEditorUpdated(TextEditor& editor)
 			juce::IPAddress(m_DS100IpAndPortEdit->getText().upToFirstOccurrenceOf(":", false, true)),
 			m_DS100IpAndPortEdit->getText().fromFirstOccurrenceOf(":", false, true).getIntValue() % 0xffff);
 	}
+	else if (m_SecondDS100MirrorFailoverTimeEdit && m_SecondDS100MirrorFailoverTimeEdit.get() == &editor)
+		ctrl->SetDS100MirrorFailoverTime(DCP_Settings, m_SecondDS100MirrorFailoverTimeEdit->getText().getIntValue());
 	else if (m_SecondDS100IpAndPortEdit && m_SecondDS100IpAndPortEdit.get() == &editor)
 	{
 		ctrl->SetSecondDS100IpAndPort(DCP_Settings,
@@ -1694,6 +1706,13 @@ void SettingsSectionsComponent::processUpdatedDS100Config()
 	}
 	if (m_SecondDS100ParallelModeLabel)
 		m_SecondDS100ParallelModeLabel->setEnabled(ctrl->GetExtensionMode() == EM_Parallel && ctrl->GetDS100ProtocolType() != PT_NoProtocol);
+	if (m_SecondDS100MirrorFailoverTimeEdit)
+	{
+		m_SecondDS100MirrorFailoverTimeEdit->setText(ctrl->GetExtensionMode() == EM_Mirror ? (juce::String(ctrl->GetDS100MirrorFailoverTime()) + UNIT_MILLISECOND) : "");
+		m_SecondDS100MirrorFailoverTimeEdit->setEnabled(ctrl->GetExtensionMode() == EM_Mirror && ctrl->GetDS100ProtocolType() != PT_NoProtocol);
+	}
+	if (m_SecondDS100MirrorFailoverTimeLabel)
+		m_SecondDS100MirrorFailoverTimeLabel->setEnabled(ctrl->GetExtensionMode() == EM_Mirror && ctrl->GetDS100ProtocolType() != PT_NoProtocol);
 	if (m_SecondDS100IpAndPortEdit)
 	{
 		auto ipAndPort = ctrl->GetSecondDS100IpAndPort();
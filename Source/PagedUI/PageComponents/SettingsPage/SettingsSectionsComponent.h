@@ -148,6 +148,7 @@ private:
 
 	// input filters for texteditors
 	std::unique_ptr<TextEditor::LengthAndCharacterRestriction>	m_intervalEditFilter;
+	std::unique_ptr<TextEditor::LengthAndCharacterRestriction>	m_failoverTimeEditFilter;
 	std::unique_ptr<TextEditor::LengthAndCharacterRestriction>	m_ipAddressEditFilter;
 	std::unique_ptr<TextEditor::LengthAndCharacterRestriction>	m_portEditFilter;
 	std::unique_ptr<TextEditor::LengthAndCharacterRestriction>	m_mappingEditFilter;
@@ -201,6 +202,8 @@ private:
 	std::unique_ptr<Label>										m_SecondDS100ParallelModeLabel;
 	const std::vector<std::string>								m_SecondDS100ParallelModes{ "1st", "2nd" };
 	std::map<std::string, uint64>								m_SecondDS100ParallelModeButtonIds;
+	std::unique_ptr<JUCEAppBasics::FixedFontTextEditor>			m_SecondDS100MirrorFailoverTimeEdit;
+	std::unique_ptr<Label>										m_SecondDS100MirrorFailoverTimeLabel;
 
 	std::unique_ptr<ProjectDummyDataLoaderComponent>			m_DS100ProjectDummyDataLoader;
 	std::unique_ptr<Label>										m_DS100ProjectDummyDataLabel;
@@ -128,8 +128,10 @@ void SoundobjectTableComponent::UpdateTable()
 	auto table = GetTable();
 	if (table)
 	{
-		// Refresh table
+		// Refresh table. The read-only cells are painted instead of using components,
+		// so an explicit repaint is required for them to reflect updated values.
 		table->updateContent();
+		table->repaint();
 
 		// Refresh table header
 		auto customTableHeader = dynamic_cast<BridgingAwareTableHeaderComponent*>(&table->getHeader());
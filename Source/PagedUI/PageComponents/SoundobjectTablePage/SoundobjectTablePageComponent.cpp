@@ -567,11 +567,17 @@ void SoundobjectTablePageComponent::UpdateGui(bool init)
 	Controller* ctrl = Controller::GetInstance();
 	if (ctrl && m_soundobjectsTable)
 	{
-		if (ctrl->PopParameterChanged(DCP_SoundobjectTable, DCT_NumProcessors) || init)
+		auto numProcessorsChanged = ctrl->PopParameterChanged(DCP_SoundobjectTable, DCT_NumProcessors);
+		if (init)
 		{
 			m_soundobjectsTable->RecreateTableRowIds();
 			m_soundobjectsTable->UpdateTable();
 		}
+		else if (numProcessorsChanged)
+		{
+			m_soundobjectsTable->UpdateTableRowIds();
+			m_soundobjectsTable->UpdateTable();
+		}
 		else if (ctrl->PopParameterChanged(DCP_Protocol, DCT_ProcessorSelection) ||
 			ctrl->PopParameterChanged(DCP_Host, DCT_BridgingConfig))
 		{
@@ -580,14 +586,17 @@ void SoundobjectTablePageComponent::UpdateGui(bool init)
 		else
 		{
 			// Iterate through all procssor instances and see if anything changed there.
+			// All change flags are popped, but the table is refreshed only once, since
+			// a refresh covers all visible rows anyway.
+			auto processorConfigChanged = false;
 			for (auto const& processorId : ctrl->GetSoundobjectProcessorIds())
 			{
 				auto processor = ctrl->GetSoundobjectProcessor(processorId);
 				if (processor && processor->PopParameterChanged(DCP_SoundobjectTable, DCT_SoundobjectProcessorConfig))
-				{
-					m_soundobjectsTable->UpdateTable();
-				}
+					processorConfigChanged = true;
 			}
+			if (processorConfigChanged)
+				m_soundobjectsTable->UpdateTable();
 		}
 	}
 
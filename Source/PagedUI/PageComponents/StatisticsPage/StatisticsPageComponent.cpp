@@ -20,6 +20,7 @@
 
 #include "StatisticsPlotComponent.h"
 #include "StatisticsLogComponent.h"
+#include "StatisticsTimelineComponent.h"
 
 #include "../../PageComponentManager.h"
 
@@ -48,6 +49,9 @@ StatisticsPageComponent::StatisticsPageComponent()
 	m_logComponent = std::make_unique<StatisticsLog>();
 	addAndMakeVisible(m_logComponent.get());
 
+	m_timelineComponent = std::make_unique<StatisticsTimeline>();
+	addAndMakeVisible(m_timelineComponent.get());
+
 	m_plotComponent->toggleShowDS100Traffic = [=](bool show) { m_logComponent->SetShowDS100Traffic(show); };
 
 	auto ctrl = SpaConBridge::Controller::GetInstance();
@@ -97,6 +101,7 @@ void StatisticsPageComponent::resized()
 
 	plotAndLogFlex.items.add(FlexItem(*m_plotComponent).withFlex(2).withMargin(FlexItem::Margin(5, 5, 5, 5)));
 	plotAndLogFlex.items.add(FlexItem(*m_logComponent).withFlex(1).withMargin(FlexItem::Margin(5, 5, 5, 5)));
+	plotAndLogFlex.items.add(FlexItem(*m_timelineComponent).withFlex(1).withMargin(FlexItem::Margin(5, 5, 5, 5)));
 
 	plotAndLogFlex.performLayout(bounds);
 }
@@ -35,11 +35,12 @@ namespace SpaConBridge
  */
 class StatisticsPlot;
 class StatisticsLog;
+class StatisticsTimeline;
 
 
 /**
  * Class StatisticsPageComponent is a component that contains elements for
- * protocol traffic plotting and logging
+ * protocol traffic plotting and logging and the DS100 connection timeline
  */
 class StatisticsPageComponent : public PageComponentBase,
 								public ProtocolBridgingWrapper::Listener,
@@ -66,6 +67,7 @@ protected:
 private:
 	std::unique_ptr<StatisticsPlot>	m_plotComponent;	/**> Plotting component. */
 	std::unique_ptr<StatisticsLog>	m_logComponent;		/**> Logging component. */
+	std::unique_ptr<StatisticsTimeline>	m_timelineComponent;	/**> Component showing the timeline of DS100 state changes and reconnects. */
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StatisticsPageComponent)
 };
@@ -92,6 +92,13 @@ void StatisticsPlot::paint(Graphics& g)
 	float msgRate = float(m_vertValueRange) * (float(PC_HOR_USERVISUSTEPPING) / float(PC_HOR_DEFAULTSTEPPING));
 	g.drawText(String(msgRate) + " msg/s", plotBounds.reduced(2), Justification::topLeft, true);
 
+	// standalone polling counts, as part of the DS100 traffic
+	if (m_showDS100Traffic && (m_sentPollCount > 0 || m_skippedPollCount > 0))
+		g.drawText("Polls sent " + String(m_sentPollCount) + ", skipped " + String(m_skippedPollCount), plotBounds.reduced(2), Justification::topRight, true);
+	if (m_showDS100Traffic && (m_completedBulkFetchCount > 0 || m_givenUpBulkFetchCount > 0))
+		g.drawText("Bulk fetches completed " + String(m_completedBulkFetchCount) + ", given up " + String(m_givenUpBulkFetchCount) + ", last " + String(m_lastBulkFetchDuration) + " ms",
+			plotBounds.reduced(2).withTrimmedTop(g.getCurrentFont().getHeight()), Justification::topRight, true);
+
 	// Plot graph parameters
 	auto plotDataCount = (m_plotData.empty() ? 0 : m_plotData.begin()->second.size());
 	auto plotStepWidthPx = float(plotBounds.getWidth() - 1) / float((plotDataCount > 0 ? plotDataCount : 1) - 1);
@@ -245,6 +252,16 @@ void StatisticsPlot::timerCallback()
 
 	m_vertValueRange = static_cast<int>(round(maxCurrentValueOfProtocols));
 
+	auto ctrl = SpaConBridge::Controller::GetInstance();
+	if (ctrl)
+	{
+		m_sentPollCount = ctrl->GetStandalonePollSentCount();
+		m_skippedPollCount = ctrl->GetStandalonePollSkippedCount();
+		m_completedBulkFetchCount = ctrl->GetStandaloneBulkFetchCompletedCount();
+		m_givenUpBulkFetchCount = ctrl->GetStandaloneBulkFetchGivenUpCount();
+		m_lastBulkFetchDuration = ctrl->GetStandaloneBulkFetchLastDuration();
+	}
+
 	if (isVisible())
 		repaint();
 }
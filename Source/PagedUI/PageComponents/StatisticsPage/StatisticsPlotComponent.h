@@ -66,6 +66,11 @@ private:
 
 	bool m_showDS100Traffic{ false };
 	int	m_vertValueRange;	/**< Vertical max plot value (value range). */
+	int	m_sentPollCount{ 0 };		/**< Count of standalone object polls sent to DS100, as last read from controller. */
+	int	m_skippedPollCount{ 0 };	/**< Count of standalone object polls skipped due to unchanged values, as last read from controller. */
+	int	m_completedBulkFetchCount{ 0 };	/**< Count of standalone object bulk fetches that received all values, as last read from controller. */
+	int	m_givenUpBulkFetchCount{ 0 };	/**< Count of standalone object bulk fetches given up due to missing values, as last read from controller. */
+	int	m_lastBulkFetchDuration{ 0 };	/**< Duration in ms of the latest completed or given up bulk fetch, as last read from controller. */
 	std::map<ProtocolBridgingType, int>					m_currentMsgPerProtocol;	/**< Map to help counting messages per protocol in current interval. This is processed every timer callback to update plot data. */
 	std::map<ProtocolBridgingType, std::vector<float>>	m_plotData;					/**< Data for plotting. Primitive vector of floats that represents the msg count per hor. step width. */
 
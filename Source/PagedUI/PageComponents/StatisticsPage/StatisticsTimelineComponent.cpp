@@ -0,0 +1,211 @@
+/* Copyright (c) 2020-2023, Christian Ahrens
+ *
+ * This file is part of SpaConBridge <https://github.com/ChristianAhrens/SpaConBridge>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include "StatisticsTimelineComponent.h"
+
+#include "StatisticsLogComponent.h"
+
+#include "../../../Controller.h"
+
+
+namespace SpaConBridge
+{
+
+
+/*
+===============================================================================
+	Class StatisticsTimeline
+===============================================================================
+*/
+
+/**
+ * Class constructor.
+ */
+StatisticsTimeline::StatisticsTimeline()
+{
+	m_table = std::make_unique<TableListBox>();
+	m_table->setModel(this);
+	m_table->setRowHeight(25);
+	m_table->setOutlineThickness(1);
+	m_table->setClickingTogglesRowSelection(false);
+	addAndMakeVisible(m_table.get());
+
+	int tableHeaderFlags = (TableHeaderComponent::visible);
+	m_table->getHeader().addColumn("Time", STC_Time, 90, 90, -1, tableHeaderFlags);
+	m_table->getHeader().addColumn("Origin", STC_Source, 60, 60, -1, tableHeaderFlags);
+	m_table->getHeader().addColumn("Event", STC_Event, 160, 120, -1, tableHeaderFlags);
+	m_table->getHeader().addColumn("Duration", STC_Duration, 70, 70, -1, tableHeaderFlags);
+
+	startTimer(LC_HOR_DEFAULTSTEPPING);
+}
+
+/**
+ * Class destructor.
+ */
+StatisticsTimeline::~StatisticsTimeline()
+{
+}
+
+/**
+ * Reimplemented to resize and re-postion controls.
+ */
+void StatisticsTimeline::resized()
+{
+	m_table->setBounds(getLocalBounds());
+}
+
+/**
+ * Reimplemented from Timer - called every timeout timer
+ *
+ * Takes a new copy of the timeline from controller, if it has changed.
+ */
+void StatisticsTimeline::timerCallback()
+{
+	auto ctrl = Controller::GetInstance();
+	if (!ctrl)
+		return;
+
+	auto timelineEntryCount = ctrl->GetReconnectTimelineEntryCount();
+	if (timelineEntryCount == m_timelineEntryCount)
+		return;
+
+	m_timelineEntryCount = timelineEntryCount;
+	m_timeline = ctrl->GetReconnectTimeline();
+	m_table->updateContent();
+	m_table->repaint();
+}
+
+/**
+ * This is overloaded from TableListBoxModel, and must return the total number of rows in our table.
+ * @return	Number of rows on the table, equal to number of timeline entries.
+ */
+int StatisticsTimeline::getNumRows()
+{
+	return static_cast<int>(m_timeline.size());
+}
+
+/**
+ * This is overloaded from TableListBoxModel, and should fill in the background of the whole row.
+ * @param g					Graphics context that must be used to do the drawing operations.
+ * @param rowNumber			Number of row to paint.
+ * @param width				Width of area to paint.
+ * @param height			Height of area to paint.
+ * @param rowIsSelected		True if row is currently selected.
+ */
+void StatisticsTimeline::paintRowBackground(Graphics& g, int rowNumber, int width, int height, bool rowIsSelected)
+{
+	ignoreUnused(rowNumber);
+
+	// Selected rows have a different background color.
+	if (rowIsSelected)
+		g.setColour(getLookAndFeel().findColour(TableHeaderComponent::highlightColourId));
+	else
+		g.setColour(getLookAndFeel().findColour(TableListBox::backgroundColourId));
+	g.fillRect(0, 0, width, height - 1);
+
+	// Line between rows.
+	g.setColour(getLookAndFeel().findColour(ListBox::outlineColourId));
+	g.fillRect(0, height - 1, width, height - 1);
+}
+
+/**
+ * This is overloaded from TableListBoxModel, and must paint any cells that aren't using custom components.
+ * The newest timeline entry is shown in the first row.
+ * @param g					Graphics context that must be used to do the drawing operations.
+ * @param rowNumber			Number of row to paint (starts at 0)
+ * @param columnId			Number of column to paint (starts at 1).
+ * @param width				Width of area to paint.
+ * @param height			Height of area to paint.
+ * @param rowIsSelected		True if row is currently selected.
+ */
+void StatisticsTimeline::paintCell(Graphics& g, int rowNumber, int columnId, int width, int height, bool rowIsSelected)
+{
+	ignoreUnused(rowIsSelected);
+
+	auto timelineIdx = static_cast<int>(m_timeline.size()) - 1 - rowNumber;
+	if (timelineIdx < 0 || timelineIdx >= static_cast<int>(m_timeline.size()))
+		return;
+
+	auto const& entry = m_timeline.at(timelineIdx);
+	auto cellRect = Rectangle<int>(width, height).reduced(3, 0);
+
+	if (columnId == STC_Source && entry._protocolId != -1)
+		g.setColour(GetProtocolBridgingColour(PBT_DS100));
+	else if (entry._type == ReconnectManager::TET_GaveUp)
+		g.setColour(Colours::red);
+	else
+		g.setColour(getLookAndFeel().findColour(TableListBox::textColourId));
+
+	g.drawFittedText(GetCellText(entry, columnId), cellRect, (columnId == STC_Event) ? Justification::centredLeft : Justification::centred, 1);
+}
+
+/**
+ * This is overloaded from TableListBoxModel, and should choose the best width for the specified column.
+ * @param columnId	Desired column ID.
+ * @return	Width to be used for the desired column.
+ */
+int StatisticsTimeline::getColumnAutoSizeWidth(int columnId)
+{
+	switch (columnId)
+	{
+	case STC_Time:
+		return 90;
+	case STC_Source:
+		return 60;
+	case STC_Event:
+		return 160;
+	case STC_Duration:
+		return 70;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+/**
+ * Helper method to get the text to show in a cell for a timeline entry.
+ * @param entry		The timeline entry to get the cell text for.
+ * @param columnId	The column to get the cell text for.
+ * @return	The requested cell text.
+ */
+String StatisticsTimeline::GetCellText(const ReconnectManager::TimelineEntry& entry, int columnId)
+{
+	switch (columnId)
+	{
+	case STC_Time:
+		return entry._time.formatted("%H:%M:%S.") + String(entry._time.getMilliseconds()).paddedLeft('0', 3);
+	case STC_Source:
+		if (entry._protocolId == DS100_1_PROCESSINGPROTOCOL_ID)
+			return GetProtocolBridgingShortName(PBT_DS100);
+		else if (entry._protocolId == DS100_2_PROCESSINGPROTOCOL_ID)
+			return GetProtocolBridgingShortName(PBT_DS100) + "(2nd)";
+		else
+			return "Node";
+	case STC_Event:
+		return entry._description;
+	case STC_Duration:
+		return (entry._duration >= 0) ? String(entry._duration) + "ms" : String();
+	default:
+		return String();
+	}
+}
+
+
+} // namespace SpaConBridge
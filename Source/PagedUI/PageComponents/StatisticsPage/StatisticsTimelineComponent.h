@@ -0,0 +1,78 @@
+/* Copyright (c) 2020-2023, Christian Ahrens
+ *
+ * This file is part of SpaConBridge <https://github.com/ChristianAhrens/SpaConBridge>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include "../../../SpaConBridgeCommon.h"
+#include "../../../ReconnectManager.h"
+
+
+namespace SpaConBridge
+{
+
+
+/**
+ * StatisticsTimeline class shows the timeline of DS100 state changes and
+ * reconnects of the bridging node, newest first, with their durations.
+ */
+class StatisticsTimeline :	public Component,
+							private Timer,
+							public TableListBoxModel
+{
+public:
+	enum StatisticsTimelineColumn
+	{
+		STC_None = 0,		//< Juce column IDs start at 1
+		STC_Time,
+		STC_Source,
+		STC_Event,
+		STC_Duration,
+		STC_MAX_COLUMNS
+	};
+
+public:
+	StatisticsTimeline();
+	~StatisticsTimeline() override;
+
+	//==========================================================================
+	int getNumRows() override;
+	void paintRowBackground(Graphics& g, int rowNumber, int width, int height, bool rowIsSelected) override;
+	void paintCell(Graphics& g, int rowNumber, int columnId, int width, int height, bool rowIsSelected) override;
+	int getColumnAutoSizeWidth(int columnId) override;
+
+protected:
+	//==============================================================================
+	void resized() override;
+
+private:
+	String GetCellText(const ReconnectManager::TimelineEntry& entry, int columnId);
+
+	//==============================================================================
+	void timerCallback() override;
+
+private:
+	std::unique_ptr<TableListBox>					m_table;					/**< The table component itself. */
+	std::vector<ReconnectManager::TimelineEntry>	m_timeline;					/**< Copy of the timeline entries shown, oldest first. */
+	int												m_timelineEntryCount{ 0 };	/**< Count of timeline entries the copy was taken at, to detect changes. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StatisticsTimeline)
+};
+
+
+} // namespace SpaConBridge
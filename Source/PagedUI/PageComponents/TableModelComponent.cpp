@@ -388,480 +388,323 @@ void TableModelComponent::SelectAllRows(bool all)
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by procssor's SoundobjectId.
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first procssor's SoundobjectId is less than the second's.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by procssor's SoundobjectId.
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The sort key of the processor.
  */
-bool TableModelComponent::LessThanSoundobjectId(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetSoundobjectIdSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return {};
 
-	auto processorIds = ctrl->GetSoundobjectProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto processor = ctrl->GetSoundobjectProcessor(processorId);
+	if (!processor)
 	{
-		auto p1 = ctrl->GetSoundobjectProcessor(pId1);
-		auto p2 = ctrl->GetSoundobjectProcessor(pId2);
-		if (p1 && p2)
-			return (p1->GetSoundobjectId() < p2->GetSoundobjectId());
+		jassertfalse; // Invalid processor id!
+		return {};
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	return static_cast<int>(processor->GetSoundobjectId());
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by procssor's MatrixInputId.
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first procssor's SoundobjectId is less than the second's.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by procssor's MatrixInputId.
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The sort key of the processor.
  */
-bool TableModelComponent::LessThanMatrixInputId(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetMatrixInputIdSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return {};
 
-	auto processorIds = ctrl->GetMatrixInputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto processor = ctrl->GetMatrixInputProcessor(processorId);
+	if (!processor)
 	{
-		auto p1 = ctrl->GetMatrixInputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixInputProcessor(pId2);
-		if (p1 && p2)
-			return (p1->GetMatrixInputId() < p2->GetMatrixInputId());
+		jassertfalse; // Invalid processor id!
+		return {};
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	return static_cast<int>(processor->GetMatrixInputId());
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by procssor's SoundobjectId.
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first procssor's SoundobjectId is less than the second's.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by procssor's MatrixOutputId.
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The sort key of the processor.
  */
-bool TableModelComponent::LessThanMatrixOutputId(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetMatrixOutputIdSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return {};
 
-	auto processorIds = ctrl->GetMatrixOutputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto processor = ctrl->GetMatrixOutputProcessor(processorId);
+	if (!processor)
 	{
-		auto p1 = ctrl->GetMatrixOutputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixOutputProcessor(pId2);
-		if (p1 && p2)
-			return (p1->GetMatrixOutputId() < p2->GetMatrixOutputId());
+		jassertfalse; // Invalid processor id!
+		return {};
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	return static_cast<int>(processor->GetMatrixOutputId());
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by procssor's MappingId.
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first MappingId is less than the second.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by procssor's name (currentProgram).
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The sort key of the processor.
  */
-bool TableModelComponent::LessThanMapping(juce::int32 pId1, juce::int32 pId2)
+juce::String TableModelComponent::GetNameSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return {};
 
-	auto processorIds = ctrl->GetSoundobjectProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto processor = ctrl->GetSoundobjectProcessor(processorId);
+	if (!processor)
 	{
-		auto p1 = ctrl->GetSoundobjectProcessor(pId1);
-		auto p2 = ctrl->GetSoundobjectProcessor(pId2);
-		if (p1 && p2)
-			return (p1->GetMappingId() < p2->GetMappingId());
+		jassertfalse; // Invalid processor id!
+		return {};
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	return processor->getProgramName(processor->getCurrentProgram());
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by procssor's name (currentProgram).
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first Name is less than the second.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by procssor's MappingId.
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The sort key of the processor.
  */
-bool TableModelComponent::LessThanName(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetMappingSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return {};
 
-	auto processorIds = ctrl->GetSoundobjectProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto processor = ctrl->GetSoundobjectProcessor(processorId);
+	if (!processor)
 	{
-		auto p1 = ctrl->GetSoundobjectProcessor(pId1);
-		auto p2 = ctrl->GetSoundobjectProcessor(pId2);
-		if (p1 && p2)
-			return (p1->getProgramName(p1->getCurrentProgram()) < p2->getProgramName(p2->getCurrentProgram()));
+		jassertfalse; // Invalid processor id!
+		return {};
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	return static_cast<int>(processor->GetMappingId());
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by procssor's ComsMode. 
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first procssor's ComsMode is less than the second's.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by procssor's ComsMode.
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The sort key of the processor.
  */
-bool TableModelComponent::LessThanComsMode(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetComsModeSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return {};
 
-	auto processorIds = ctrl->GetSoundobjectProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto processor = ctrl->GetSoundobjectProcessor(processorId);
+	if (!processor)
 	{
-		auto p1 = ctrl->GetSoundobjectProcessor(pId1);
-		auto p2 = ctrl->GetSoundobjectProcessor(pId2);
-		if (p1 && p2)
-			return (p1->GetComsMode() < p2->GetComsMode());
+		jassertfalse; // Invalid processor id!
+		return {};
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	return static_cast<int>(processor->GetComsMode());
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by mute states.
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first procssor's mute states are 'muted' for more protocols than the second's.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by mute states.
+ * Comparing mutes does not make too much sense. Nevertheless, to have some defined behaviour, we use the
+ * collected count of muted briding protocols of every processor for this.
+ * (Nothing muted < some protocols muted < all protocols muted)
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The count of active bridging protocols the processor is muted for.
  */
-bool TableModelComponent::LessThanSoundobjectBridgingMute(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetSoundobjectBridgingMuteSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return 0;
 
-	// Comparing mutes does not make too much sense.
-	// Nevertheless, to have some defined behaviour, we use the collected 
-	// count of muted briding protocols of every soundsource for this.
-	// (Nothing muted < some protocols muted < all protocols muted)
-	auto processorIds = ctrl->GetSoundobjectProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto mutedProtocolCount = 0;
+	auto activeBridging = ctrl->GetActiveProtocolBridging();
+	for (const auto& bridgingType : ProtocolBridgingTypes)
 	{
-		auto p1 = ctrl->GetSoundobjectProcessor(pId1);
-		auto p2 = ctrl->GetSoundobjectProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto mutedProtocolCountP1 = 0;
-			auto mutedProtocolCountP2 = 0;
-
-			for (const auto&bridgingType : ProtocolBridgingTypes)
-			{
-				auto activeBridging = ctrl->GetActiveProtocolBridging();
-				if ((activeBridging & bridgingType) == bridgingType)
-				{
-					mutedProtocolCountP1 += ctrl->GetMuteBridgingSoundobjectProcessorId(bridgingType, pId1) ? 1 : 0;
-					mutedProtocolCountP2 += ctrl->GetMuteBridgingSoundobjectProcessorId(bridgingType, pId2) ? 1 : 0;
-				}
-			}
-
-			return (mutedProtocolCountP1 < mutedProtocolCountP2);
-		}
+		if ((activeBridging & bridgingType) == bridgingType)
+			mutedProtocolCount += ctrl->GetMuteBridgingSoundobjectProcessorId(bridgingType, processorId) ? 1 : 0;
 	}
-	
-	jassertfalse;
-	return false;
+
+	return mutedProtocolCount;
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by mute states.
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first procssor's mute states are 'muted' for more protocols than the second's.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by mute states.
+ * Comparing mutes does not make too much sense. Nevertheless, to have some defined behaviour, we use the
+ * collected count of muted briding protocols of every processor for this.
+ * (Nothing muted < some protocols muted < all protocols muted)
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The count of active bridging protocols the processor is muted for.
  */
-bool TableModelComponent::LessThanMatrixInputBridgingMute(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetMatrixInputBridgingMuteSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return 0;
 
-	// Comparing mutes does not make too much sense.
-	// Nevertheless, to have some defined behaviour, we use the collected 
-	// count of muted briding protocols of every soundsource for this.
-	// (Nothing muted < some protocols muted < all protocols muted)
-	auto processorIds = ctrl->GetMatrixInputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto mutedProtocolCount = 0;
+	auto activeBridging = ctrl->GetActiveProtocolBridging();
+	for (const auto& bridgingType : ProtocolBridgingTypes)
 	{
-		auto p1 = ctrl->GetMatrixInputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixInputProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto mutedProtocolCountP1 = 0;
-			auto mutedProtocolCountP2 = 0;
-
-			for (const auto&bridgingType : ProtocolBridgingTypes)
-			{
-				auto activeBridging = ctrl->GetActiveProtocolBridging();
-				if ((activeBridging & bridgingType) == bridgingType)
-				{
-					mutedProtocolCountP1 += ctrl->GetMuteBridgingMatrixInputProcessorId(bridgingType, pId1) ? 1 : 0;
-					mutedProtocolCountP2 += ctrl->GetMuteBridgingMatrixInputProcessorId(bridgingType, pId2) ? 1 : 0;
-				}
-			}
-
-			return (mutedProtocolCountP1 < mutedProtocolCountP2);
-		}
+		if ((activeBridging & bridgingType) == bridgingType)
+			mutedProtocolCount += ctrl->GetMuteBridgingMatrixInputProcessorId(bridgingType, processorId) ? 1 : 0;
 	}
 
-	jassertfalse;
-	return false;
+	return mutedProtocolCount;
 }
 
 /**
- * Helper sorting function used by std::sort(). This version is used to sort by mute states.
- * @param pId1	Id of the first processor.
- * @param pId2	Id of the second processor.
- * @return	True if the first procssor's mute states are 'muted' for more protocols than the second's.
+ * Helper sort key extraction function used by SortProcessorIds(). This version is used to sort by mute states.
+ * Comparing mutes does not make too much sense. Nevertheless, to have some defined behaviour, we use the
+ * collected count of muted briding protocols of every processor for this.
+ * (Nothing muted < some protocols muted < all protocols muted)
+ * @param processorId	Id of the processor to get the sort key for.
+ * @return	The count of active bridging protocols the processor is muted for.
  */
-bool TableModelComponent::LessThanMatrixOutputBridgingMute(juce::int32 pId1, juce::int32 pId2)
+int TableModelComponent::GetMatrixOutputBridgingMuteSortKey(juce::int32 processorId)
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return 0;
 
-	// Comparing mutes does not make too much sense.
-	// Nevertheless, to have some defined behaviour, we use the collected 
-	// count of muted briding protocols of every soundsource for this.
-	// (Nothing muted < some protocols muted < all protocols muted)
-	auto processorIds = ctrl->GetMatrixOutputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto mutedProtocolCount = 0;
+	auto activeBridging = ctrl->GetActiveProtocolBridging();
+	for (const auto& bridgingType : ProtocolBridgingTypes)
 	{
-		auto p1 = ctrl->GetMatrixOutputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixOutputProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto mutedProtocolCountP1 = 0;
-			auto mutedProtocolCountP2 = 0;
-
-			for (const auto&bridgingType : ProtocolBridgingTypes)
-			{
-				auto activeBridging = ctrl->GetActiveProtocolBridging();
-				if ((activeBridging & bridgingType) == bridgingType)
-				{
-					mutedProtocolCountP1 += ctrl->GetMuteBridgingMatrixOutputProcessorId(bridgingType, pId1) ? 1 : 0;
-					mutedProtocolCountP2 += ctrl->GetMuteBridgingMatrixOutputProcessorId(bridgingType, pId2) ? 1 : 0;
-				}
-			}
-
-			return (mutedProtocolCountP1 < mutedProtocolCountP2);
-		}
+		if ((activeBridging & bridgingType) == bridgingType)
+			mutedProtocolCount += ctrl->GetMuteBridgingMatrixOutputProcessorId(bridgingType, processorId) ? 1 : 0;
 	}
 
-	jassertfalse;
-	return false;
+	return mutedProtocolCount;
 }
 
-bool TableModelComponent::LessThanSoundobjectUiActive(juce::int32 pId1, juce::int32 pId2)
+/**
+ * Helper to sort m_processorIds by the given column, using the column's sort key extraction function.
+ * @param sortColumnId	ID of the column selected for sorting.
+ * @param isForwards	True if sorting from smallest to largest.
+ * @return	True if the column provides sort keys and m_processorIds was sorted, false if not.
+ */
+bool TableModelComponent::SortProcessorIdsByColumn(int sortColumnId, bool isForwards)
 {
-	auto ctrl = Controller::GetInstance();
-	if (!ctrl)
-		return false;
-
-	auto processorIds = ctrl->GetSoundobjectProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	// Use a different helper sort key extraction function depending on which column is selected for sorting.
+	switch (sortColumnId)
 	{
-		auto p1 = ctrl->GetSoundobjectProcessor(pId1);
-		auto p2 = ctrl->GetSoundobjectProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto p1UiActiveValue = (p1->GetComsMode() | CM_Tx);
-			auto p2UiActiveValue = (p2->GetComsMode() | CM_Tx);
-			return (p1UiActiveValue < p2UiActiveValue);
-		}
+	case BridgingAwareTableHeaderComponent::TC_SoundobjectID:
+		SortProcessorIds(isForwards, TableModelComponent::GetSoundobjectIdSortKey);
+		break;
+	case BridgingAwareTableHeaderComponent::TC_InputID:
+	case BridgingAwareTableHeaderComponent::TC_InputEditor:
+		SortProcessorIds(isForwards, TableModelComponent::GetMatrixInputIdSortKey);
+		break;
+	case BridgingAwareTableHeaderComponent::TC_OutputID:
+	case BridgingAwareTableHeaderComponent::TC_OutputEditor:
+		SortProcessorIds(isForwards, TableModelComponent::GetMatrixOutputIdSortKey);
+		break;
+	case BridgingAwareTableHeaderComponent::TC_Mapping:
+		SortProcessorIds(isForwards, TableModelComponent::GetMappingSortKey);
+		break;
+	case BridgingAwareTableHeaderComponent::TC_Name:
+		SortProcessorIds(isForwards, TableModelComponent::GetNameSortKey);
+		break;
+	case BridgingAwareTableHeaderComponent::TC_ComsMode:
+		SortProcessorIds(isForwards, TableModelComponent::GetComsModeSortKey);
+		break;
+	case BridgingAwareTableHeaderComponent::TC_BridgingMute:
+		if (GetTableType() == TT_Soundobjects)
+			SortProcessorIds(isForwards, TableModelComponent::GetSoundobjectBridgingMuteSortKey);
+		else if (GetTableType() == TT_MatrixInputs)
+			SortProcessorIds(isForwards, TableModelComponent::GetMatrixInputBridgingMuteSortKey);
+		else if (GetTableType() == TT_MatrixOutputs)
+			SortProcessorIds(isForwards, TableModelComponent::GetMatrixOutputBridgingMuteSortKey);
+		break;
+	default:
+		return false;
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	return true;
 }
 
-bool TableModelComponent::LessThanMatrixInputUiActive(juce::int32 pId1, juce::int32 pId2)
+/**
+ * This incrementally updates m_processorIds to the currently existing processors of the table's type,
+ * keeping the current sorting and only touching the rows of added or removed processors.
+ */
+void TableModelComponent::UpdateTableRowIds()
 {
 	auto ctrl = Controller::GetInstance();
 	if (!ctrl)
-		return false;
+		return;
 
-	auto processorIds = ctrl->GetMatrixInputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	// Use the controller's processor id getter that matches the processors shown in this table.
+	std::vector<juce::int32>(Controller::*getProcessorIds)() const = nullptr;
+	switch (GetTableType())
 	{
-		auto p1 = ctrl->GetMatrixInputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixInputProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto p1UiActiveValue = (p1->GetComsMode() | CM_Tx);
-			auto p2UiActiveValue = (p2->GetComsMode() | CM_Tx);
-			return (p1UiActiveValue < p2UiActiveValue);
-		}
+	case TT_Soundobjects:
+		getProcessorIds = &Controller::GetSoundobjectProcessorIds;
+		break;
+	case TT_MatrixInputs:
+		getProcessorIds = &Controller::GetMatrixInputProcessorIds;
+		break;
+	case TT_MatrixOutputs:
+		getProcessorIds = &Controller::GetMatrixOutputProcessorIds;
+		break;
+	case TT_Invalid:
+	default:
+		jassertfalse; // Table type must be set to know what processors to show!
+		return;
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
+	ApplyTableRowIdsDelta((ctrl->*getProcessorIds)());
 }
-bool TableModelComponent::LessThanMatrixOutputUiActive(juce::int32 pId1, juce::int32 pId2)
-{
-	auto ctrl = Controller::GetInstance();
-	if (!ctrl)
-		return false;
 
-	auto processorIds = ctrl->GetMatrixOutputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
-	{
-		auto p1 = ctrl->GetMatrixOutputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixOutputProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto p1UiActiveValue = (p1->GetComsMode() | CM_Tx);
-			auto p2UiActiveValue = (p2->GetComsMode() | CM_Tx);
-			return (p1UiActiveValue < p2UiActiveValue);
-		}
-	}
-
-	jassertfalse; // Index out of range!
-	return false;
-}
-bool TableModelComponent::LessThanSoundobjectReadActive(juce::int32 pId1, juce::int32 pId2)
+/**
+ * Helper to incrementally update m_processorIds to the given list of currently existing processors,
+ * instead of clearing and re-filling it. Rows of removed processors are dropped, new processors are
+ * appended in the given order and the table's current sort order is reapplied, which only has to move
+ * the new rows into place. Rows of unaffected processors keep their relative order.
+ * @param currentProcessorIds	The ids of all currently existing processors.
+ * @return	True if any rows were removed or inserted, false if m_processorIds was already up to date.
+ */
+bool TableModelComponent::ApplyTableRowIdsDelta(const std::vector<juce::int32>& currentProcessorIds)
 {
-	auto ctrl = Controller::GetInstance();
-	if (!ctrl)
-		return false;
-
-	auto processorIds = ctrl->GetSoundobjectProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
+	auto currentProcessorIdSet = std::set<juce::int32>(currentProcessorIds.begin(), currentProcessorIds.end());
+	auto knownProcessorIdSet = std::set<juce::int32>(m_processorIds.begin(), m_processorIds.end());
+
+	// Remove the rows of processors that do no longer exist.
+	auto removedIdsIter = std::remove_if(m_processorIds.begin(), m_processorIds.end(), [&currentProcessorIdSet](juce::int32 processorId) {
+		return currentProcessorIdSet.count(processorId) == 0;
+	});
+	auto rowsRemoved = (removedIdsIter != m_processorIds.end());
+	m_processorIds.erase(removedIdsIter, m_processorIds.end());
+
+	// Append the rows of processors that are new.
+	auto rowsInserted = false;
+	m_processorIds.reserve(currentProcessorIds.size());
+	for (auto const& processorId : currentProcessorIds)
 	{
-		auto p1 = ctrl->GetSoundobjectProcessor(pId1);
-		auto p2 = ctrl->GetSoundobjectProcessor(pId2);
-		if (p1 && p2)
+		if (knownProcessorIdSet.count(processorId) == 0)
 		{
-			auto p1ReadActiveValue = (p1->GetComsMode() | CM_Rx);
-			auto p2ReadActiveValue = (p2->GetComsMode() | CM_Rx);
-			return (p1ReadActiveValue < p2ReadActiveValue);
+			m_processorIds.push_back(processorId);
+			rowsInserted = true;
 		}
 	}
 
-	jassertfalse; // Index out of range!
-	return false;
-}
-bool TableModelComponent::LessThanMatrixInputReadActive(juce::int32 pId1, juce::int32 pId2)
-{
-	auto ctrl = Controller::GetInstance();
-	if (!ctrl)
-		return false;
-
-	auto processorIds = ctrl->GetMatrixInputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
-	{
-		auto p1 = ctrl->GetMatrixInputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixInputProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto p1ReadActiveValue = (p1->GetComsMode() | CM_Rx);
-			auto p2ReadActiveValue = (p2->GetComsMode() | CM_Rx);
-			return (p1ReadActiveValue < p2ReadActiveValue);
-		}
-	}
+	// Move the new rows to where they belong in the current sort order.
+	if (rowsInserted && m_table && m_table->getHeader().getSortColumnId() != 0)
+		SortProcessorIdsByColumn(m_table->getHeader().getSortColumnId(), m_table->getHeader().isSortedForwards());
 
-	jassertfalse; // Index out of range!
-	return false;
+	return (rowsRemoved || rowsInserted);
 }
-bool TableModelComponent::LessThanMatrixOutputReadActive(juce::int32 pId1, juce::int32 pId2)
-{
-	auto ctrl = Controller::GetInstance();
-	if (!ctrl)
-		return false;
-
-	auto processorIds = ctrl->GetMatrixOutputProcessorIds();
-	auto maxProcessorIdIter = std::max_element(processorIds.begin(), processorIds.end());
-	if (maxProcessorIdIter == processorIds.end())
-		return false;
-	auto maxProcessorId = *maxProcessorIdIter;
-	if ((pId1 <= maxProcessorId) && (pId2 <= maxProcessorId))
-	{
-		auto p1 = ctrl->GetMatrixOutputProcessor(pId1);
-		auto p2 = ctrl->GetMatrixOutputProcessor(pId2);
-		if (p1 && p2)
-		{
-			auto p1ReadActiveValue = (p1->GetComsMode() | CM_Rx);
-			auto p2ReadActiveValue = (p2->GetComsMode() | CM_Rx);
-			return (p1ReadActiveValue < p2ReadActiveValue);
-		}
-	}
 
-	jassertfalse; // Index out of range!
-	return false;
-}
 /**
  * This can be overridden to react to the user double-clicking on a part of the list where there are no rows. 
  * @param event	Contains position and status information about a mouse event.
@@ -904,7 +747,8 @@ void TableModelComponent::paintRowBackground(Graphics& g, int rowNumber, int wid
 
 /**
  * This is overloaded from TableListBoxModel, and must paint any cells that aren't using custom components.
- * This reimplementation does nothing (all cells use custom components).
+ * Read-only columns (currently the name column) are painted here directly instead of
+ * using a child component per cell, to keep the count of live components in the table low.
  * @param g					Graphics context that must be used to do the drawing operations.
  * @param rowNumber			Number of row to paint (starts at 0)
  * @param columnId			Number of column to paint (starts at 1).
@@ -914,12 +758,31 @@ void TableModelComponent::paintRowBackground(Graphics& g, int rowNumber, int wid
  */
 void TableModelComponent::paintCell(Graphics& g, int rowNumber, int columnId, int width, int height, bool rowIsSelected)
 {
-	ignoreUnused(g);
-	ignoreUnused(rowNumber);
-	ignoreUnused(columnId);
-	ignoreUnused(width);
-	ignoreUnused(height);
 	ignoreUnused(rowIsSelected);
+
+	switch (columnId)
+	{
+	case BridgingAwareTableHeaderComponent::TC_Name:
+		{
+			if (rowNumber < 0 || rowNumber >= static_cast<int>(m_processorIds.size()))
+				return;
+
+			auto ctrl = Controller::GetInstance();
+			if (!ctrl)
+				return;
+
+			auto processor = ctrl->GetSoundobjectProcessor(GetProcessorIdForRow(rowNumber));
+			if (!processor)
+				return;
+
+			auto cellRect = juce::Rectangle<int>(width, height).reduced(9, 4);
+			g.setColour(getLookAndFeel().findColour(TableListBox::textColourId));
+			g.drawFittedText(processor->getProgramName(processor->getCurrentProgram()), cellRect, Justification::centredLeft, 1);
+		}
+		break;
+	default:
+		break;
+	}
 }
 
 /**
@@ -935,43 +798,8 @@ void TableModelComponent::sortOrderChanged(int newSortColumnId, bool isForwards)
 	if (m_table)
 		m_table->deselectAllRows();
 
-	// Use a different helper sorting function depending on which column is selected for sorting.
-	switch (newSortColumnId)
-	{
-	case BridgingAwareTableHeaderComponent::TC_SoundobjectID:
-		std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanSoundobjectId);
-		break;
-	case BridgingAwareTableHeaderComponent::TC_InputID:
-	case BridgingAwareTableHeaderComponent::TC_InputEditor:
-		std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanMatrixInputId);
-		break;
-	case BridgingAwareTableHeaderComponent::TC_OutputID:
-	case BridgingAwareTableHeaderComponent::TC_OutputEditor:
-		std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanMatrixOutputId);
-		break;
-	case BridgingAwareTableHeaderComponent::TC_Mapping:
-		std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanMapping);
-		break;
-	case BridgingAwareTableHeaderComponent::TC_Name:
-		std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanName);
-		break;
-	case BridgingAwareTableHeaderComponent::TC_ComsMode:
-		std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanComsMode);
-		break;
-	case BridgingAwareTableHeaderComponent::TC_BridgingMute:
-		if (GetTableType() == TT_Soundobjects)
-			std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanSoundobjectBridgingMute);
-		else if (GetTableType() == TT_MatrixInputs)
-			std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanMatrixInputBridgingMute);
-		else if (GetTableType() == TT_MatrixOutputs)
-			std::sort(m_processorIds.begin(), m_processorIds.end(), TableModelComponent::LessThanMatrixOutputBridgingMute);
-		break;
-	default:
-		break;
-	}
-
-	// If reverse order is selected, reverse the list.
-	if (!isForwards)
+	// If the column does not provide sort keys, the reverse order can only be established by reversing the list.
+	if (!SortProcessorIdsByColumn(newSortColumnId, isForwards) && !isForwards)
 		std::reverse(m_processorIds.begin(), m_processorIds.end());
 
 	if (m_table)
@@ -1005,25 +833,11 @@ Component* TableModelComponent::refreshComponentForCell(int rowNumber, int colum
 	{
 
 	case BridgingAwareTableHeaderComponent::TC_EmptyHandleCellID:
-		// empty cell does not use any component
-		break;
-
 	case BridgingAwareTableHeaderComponent::TC_Name:
-		{
-			LabelContainer* label = static_cast<LabelContainer*> (existingComponentToUpdate);
-
-			// If an existing component is being passed-in for updating, we'll re-use it, but
-			// if not, we'll have to create one.
-			if (label == nullptr)
-				label = new LabelContainer(*this);
-
-			// Ensure that the comboBox knows which row number it is located at.
-			label->SetRow(rowNumber);
-
-			// Return a pointer to the comboBox.
-			ret = label;
-		}
-		break;
+		// read-only cells do not use any component, but are painted in paintCell.
+		// A recycled component handed in by the table is not needed anymore.
+		delete existingComponentToUpdate;
+		return nullptr;
 
 	case BridgingAwareTableHeaderComponent::TC_Mapping:
 		{
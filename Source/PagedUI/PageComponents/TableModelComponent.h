@@ -78,24 +78,19 @@ public:
 
 	//==========================================================================
 	virtual void RecreateTableRowIds() = 0;
+	void UpdateTableRowIds();
 	virtual void UpdateTable() = 0;
 
 	//==========================================================================
-	static bool LessThanSoundobjectId(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixInputId(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixOutputId(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanName(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMapping(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanComsMode(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanSoundobjectBridgingMute(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixInputBridgingMute(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixOutputBridgingMute(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanSoundobjectUiActive(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixInputUiActive(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixOutputUiActive(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanSoundobjectReadActive(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixInputReadActive(juce::int32 pId1, juce::int32 pId2);
-	static bool LessThanMatrixOutputReadActive(juce::int32 pId1, juce::int32 pId2);
+	static int GetSoundobjectIdSortKey(juce::int32 processorId);
+	static int GetMatrixInputIdSortKey(juce::int32 processorId);
+	static int GetMatrixOutputIdSortKey(juce::int32 processorId);
+	static juce::String GetNameSortKey(juce::int32 processorId);
+	static int GetMappingSortKey(juce::int32 processorId);
+	static int GetComsModeSortKey(juce::int32 processorId);
+	static int GetSoundobjectBridgingMuteSortKey(juce::int32 processorId);
+	static int GetMatrixInputBridgingMuteSortKey(juce::int32 processorId);
+	static int GetMatrixOutputBridgingMuteSortKey(juce::int32 processorId);
 
 	juce::int32 GetProcessorIdForRow(int rowNumber) const;
 	std::vector<juce::int32> GetProcessorIdsForRows(const std::vector<int>& rowNumbers) const;
@@ -152,9 +147,59 @@ protected:
 	void onCollapseToggled(bool collapsed);
 	void onAllowSingleSelectionOnlyToggled(bool singleSelectionOnly);
 
+	//==============================================================================
+	bool ApplyTableRowIdsDelta(const std::vector<juce::int32>& currentProcessorIds);
+	bool SortProcessorIdsByColumn(int sortColumnId, bool isForwards);
+
+	//==============================================================================
+	/**
+	 * Sorts m_processorIds by the keys the given extraction function returns for each processor.
+	 * The keys are snapshotted once per sort, instead of querying the controller in every
+	 * single comparison. If the list is already mostly in order, e.g. because only a few rows changed
+	 * since the last sort, the misplaced entries are moved in place instead of sorting the whole list.
+	 * @param	isForwards				True if sorting from smallest to largest.
+	 * @param	sortKeyForProcessorId	The function to extract the sort key of a processor.
+	 */
+	template <typename KeyType>
+	void SortProcessorIds(bool isForwards, KeyType(*sortKeyForProcessorId)(juce::int32))
+	{
+		std::vector<std::pair<KeyType, juce::int32>> keyedProcessorIds;
+		keyedProcessorIds.reserve(m_processorIds.size());
+		for (auto const& processorId : m_processorIds)
+			keyedProcessorIds.push_back(std::make_pair(sortKeyForProcessorId(processorId), processorId));
+
+		auto keyOrder = [isForwards](const std::pair<KeyType, juce::int32>& a, const std::pair<KeyType, juce::int32>& b) {
+			return isForwards ? (a.first < b.first) : (b.first < a.first);
+		};
+
+		// Count the positions where the existing order is broken, to decide between moving only the
+		// misplaced entries (binary search + rotate, stable) and a full stable sort.
+		auto outOfOrderCount = size_t(0);
+		for (auto i = size_t(1); i < keyedProcessorIds.size(); ++i)
+			if (keyOrder(keyedProcessorIds.at(i), keyedProcessorIds.at(i - 1)))
+				outOfOrderCount++;
+
+		if (outOfOrderCount == 0)
+			return;
+		else if (outOfOrderCount <= s_incrementalResortLimit)
+		{
+			for (auto iter = keyedProcessorIds.begin() + 1; iter != keyedProcessorIds.end(); ++iter)
+			{
+				if (keyOrder(*iter, *(iter - 1)))
+					std::rotate(std::upper_bound(keyedProcessorIds.begin(), iter, *iter, keyOrder), iter, iter + 1);
+			}
+		}
+		else
+			std::stable_sort(keyedProcessorIds.begin(), keyedProcessorIds.end(), keyOrder);
+
+		for (auto i = size_t(0); i < keyedProcessorIds.size(); ++i)
+			m_processorIds.at(i) = keyedProcessorIds.at(i).second;
+	}
+
 	//==============================================================================
 	std::vector<juce::int32>					m_processorIds;				/**> Local list of Processor instance IDs, one for each row in the table. */
 private:
+	static constexpr size_t						s_incrementalResortLimit{ 8 };	/**> Max count of out of order rows that are resorted in place instead of a full sort. */
 	std::unique_ptr<TableListBox>				m_table;					/**> The table component itself. */
 	TableType									m_tableType{ TT_Invalid };	/**> The type of table component. */
 	std::unique_ptr<TableControlBarComponent>	m_tableControlBar;			/**> The control bottom bar. */
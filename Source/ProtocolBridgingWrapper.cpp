@@ -35,6 +35,9 @@ ProtocolBridgingWrapper::ProtocolBridgingWrapper()
 {
 	m_processingNode.AddListener(this);
 
+	m_reconnectManager.isRecoveryRequired = [=]() { return IsDS100RecoveryRequired(); };
+	m_reconnectManager.onRecoveryAttempt = [=]() { ReconnectNode(); };
+
 	SetupBridgingNode();
 }
 
@@ -63,51 +66,26 @@ void ProtocolBridgingWrapper::AddListener(ProtocolBridgingWrapper::Listener* lis
 
 /**
  * Send a Message out via the active bridging node.
+ * The DS100(s) and channels to send to are taken from the precomputed routing table.
  * @param roi	The id of the remote object to be sent.
- * @param msgData	The message data to be sent.
+ * @param msgData	The message data to be sent. The address is mapped to the DS100 channel while sending and restored afterwards.
  * @return True on success, false on failure
  */
 bool ProtocolBridgingWrapper::SendMessage(const RemoteObjectIdentifier roi, RemoteObjectMessageData& msgData)
 {
-	if (GetDS100ExtensionMode() == EM_Mirror)
-	{
-		// if the first DS100 is master, send data to it
-		if ((GetProtocolState(DS100_1_PROCESSINGPROTOCOL_ID) & OHS_Protocol_Master) == OHS_Protocol_Master)
-			return m_processingNode.SendMessageTo(DS100_1_PROCESSINGPROTOCOL_ID, roi, msgData, ASYNC_EXTID);
+	auto channel = static_cast<std::int32_t>(msgData._addrVal._first);
+	auto route = GetDS100ChannelRoute(channel);
 
-		// if the second DS100 is master, send data to it
-		else if ((GetProtocolState(DS100_2_PROCESSINGPROTOCOL_ID) & OHS_Protocol_Master) == OHS_Protocol_Master)
-			return m_processingNode.SendMessageTo(DS100_2_PROCESSINGPROTOCOL_ID, roi, msgData, ASYNC_EXTID);
-
-		// of no master is present, we have an undefined state, cannot happen!
-		else
-			return false;
-	}
-	else if (GetDS100ExtensionMode() == EM_Extend)
+	// if no target is present (e.g. no master in mirror mode), we have an undefined state, cannot happen!
+	auto sendSuccess = (route._sendTargetCount > 0);
+	for (auto i = 0; i < route._sendTargetCount; i++)
 	{
-		if (msgData._addrVal._first > DS100_CHANNELCOUNT)
-		{
-			auto mappedChannel = static_cast<std::int32_t>(msgData._addrVal._first % DS100_CHANNELCOUNT);
-			if (mappedChannel == 0)
-				mappedChannel = static_cast<std::int32_t>(DS100_CHANNELCOUNT);
-			msgData._addrVal._first = mappedChannel;
-
-			return m_processingNode.SendMessageTo(DS100_2_PROCESSINGPROTOCOL_ID, roi, msgData, ASYNC_EXTID);
-		}
-		else
-			return m_processingNode.SendMessageTo(DS100_1_PROCESSINGPROTOCOL_ID, roi, msgData, ASYNC_EXTID);
+		msgData._addrVal._first = route._sendTargets[i]._channel;
+		sendSuccess = m_processingNode.SendMessageTo(route._sendTargets[i]._protocolId, roi, msgData, ASYNC_EXTID) && sendSuccess;
 	}
-	else if (GetDS100ExtensionMode() == EM_Parallel)
-	{
-		auto sendSuccess = m_processingNode.SendMessageTo(DS100_1_PROCESSINGPROTOCOL_ID, roi, msgData, ASYNC_EXTID);
-		sendSuccess = m_processingNode.SendMessageTo(DS100_2_PROCESSINGPROTOCOL_ID, roi, msgData, ASYNC_EXTID) && sendSuccess;
+	msgData._addrVal._first = channel;
 
-		return sendSuccess;
-	}
-	else
-	{
-		return m_processingNode.SendMessageTo(DS100_1_PROCESSINGPROTOCOL_ID, roi, msgData, ASYNC_EXTID);
-	}
+	return sendSuccess;
 }
 
 /**
@@ -142,16 +120,86 @@ bool ProtocolBridgingWrapper::Reconnect()
 	if (!ctrl || !ctrl->IsOnline()) // dont execute the reconnection if controller state suggests that the application shall be offline
 		return false;
 
+	m_reconnectManager.HandleReconnect();
+
+	ReconnectNode();
+
+	return true;
+}
+
+/**
+ * Helper to disconnect the bridging node and have it re-connected with the current config on the next controller tick.
+ */
+void ProtocolBridgingWrapper::ReconnectNode()
+{
 	Disconnect();
 
+	// forget the config the node was running with, to have it pushed to the node again even if unchanged
+	m_appliedNodeXml.reset();
+
 	auto nodeXmlElement = m_bridgingXml.getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::NODE));
 	if (nodeXmlElement)
 		SetBridgingNodeStateXml(nodeXmlElement, true);
 	m_shouldBeOnline = true;
+}
+
+/**
+ * Helper to query if lost DS100s shall be recovered by reconnecting, that is if the application
+ * is online and none of the DS100s that are in use with the current extension mode is up.
+ * Reconnecting restarts the whole node, so it is not done while a DS100 is still up, to not
+ * disrupt it and the bridged protocols for the sake of the lost one.
+ * @return	True if all DS100s that are expected to be up currently are not, false if not.
+ */
+bool ProtocolBridgingWrapper::IsDS100RecoveryRequired()
+{
+	auto ctrl = Controller::GetInstance();
+	if (!m_shouldBeOnline || !ctrl || !ctrl->IsOnline())
+		return false;
+
+	auto usedDS100Count = (GetDS100ExtensionMode() == EM_Off) ? 1 : DS100_EXTMODE_DEVICECOUNT;
+	for (auto i = 0; i < usedDS100Count; i++)
+		if ((GetProtocolState(DS100_PROCESSINGPROTOCOL_IDS[i]) & OHS_Protocol_Up) == OHS_Protocol_Up)
+			return false;
 
 	return true;
 }
 
+/**
+ * Getter for the backoff parameters used to recover lost DS100s.
+ * @return	The backoff parameters.
+ */
+const ReconnectManager::BackoffPolicy ProtocolBridgingWrapper::GetReconnectBackoffPolicy()
+{
+	return m_reconnectManager.GetBackoffPolicy();
+}
+
+/**
+ * Setter for the backoff parameters used to recover lost DS100s.
+ * @param policy	The backoff parameters to use.
+ */
+void ProtocolBridgingWrapper::SetReconnectBackoffPolicy(const ReconnectManager::BackoffPolicy& policy)
+{
+	m_reconnectManager.SetBackoffPolicy(policy);
+}
+
+/**
+ * Getter for the timeline of DS100 state changes and reconnects.
+ * @return	The timeline entries, oldest first.
+ */
+const std::vector<ReconnectManager::TimelineEntry> ProtocolBridgingWrapper::GetReconnectTimeline()
+{
+	return m_reconnectManager.GetTimeline();
+}
+
+/**
+ * Getter for the count of timeline entries that were ever added, to detect timeline changes.
+ * @return	The count of entries ever added.
+ */
+int ProtocolBridgingWrapper::GetReconnectTimelineEntryCount()
+{
+	return m_reconnectManager.GetTimelineEntryCount();
+}
+
 /**
  * Static helper method to query if the given ROI is not one of those marked for processing in application and only to be bridged to DS100.
  * @param roi	The object id to be checked regarding relevance for handling in application.
@@ -188,6 +236,21 @@ bool ProtocolBridgingWrapper::IsBridgingObjectOnly(const RemoteObjectIdentifier
 	}
 }
 
+/**
+ * Helper to get the index of a DS100 protocol in the order of DS100 devices,
+ * that defines the channel range the device serves in extension mode.
+ * @param	protocolId	The protocol id to get the DS100 device index for.
+ * @return	The DS100 device index or -1 if the protocol is no DS100 protocol.
+ */
+int ProtocolBridgingWrapper::GetDS100DeviceIndex(ProtocolId protocolId)
+{
+	for (auto i = 0; i < DS100_EXTMODE_DEVICECOUNT; i++)
+		if (DS100_PROCESSINGPROTOCOL_IDS[i] == protocolId)
+			return i;
+
+	return -1;
+}
+
 /**
  * Reimplemented from ObjectDataHandling_Abstract::StateListener to get notified on state changes
  * in bridging object handling object regarding protocol state changes.
@@ -255,6 +318,7 @@ bool ProtocolBridgingWrapper::setStateXml(XmlElement* stateXml)
 	if (stateXml && (stateXml->getTagName() == AppConfiguration::getTagName(AppConfiguration::TagID::BRIDGING)))
 	{
 		m_bridgingXml = *stateXml;
+		ClearCompiledConfigCaches();
 		auto nodeXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::NODE));
 		if (nodeXmlElement)
 		{
@@ -336,6 +400,7 @@ bool ProtocolBridgingWrapper::setStateXml(XmlElement* stateXml)
 /**
  * Method to set an updated xml config element as new bridging node config.
  * This also takes care to re-register object handling module listeners after configuration change.
+ * If the node rejects the new config, the config it keeps running with is restored in the xml config.
  * 
  * @param	stateXml		The new bridging node xml configuration to activate.
  * @return	True on success, false on failure
@@ -346,6 +411,12 @@ bool ProtocolBridgingWrapper::SetBridgingNodeStateXml(XmlElement* stateXml, bool
 	if (!stateXml || (stateXml->getTagName() != ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::NODE)))
 		return false;
 
+	// Only push the config to the node if it differs from what the node currently runs with,
+	// since the node drops all its connections when it is updated.
+	auto diff = m_appliedNodeXml ? GetNodeConfigDiff(*m_appliedNodeXml, *stateXml) : NodeConfigDiff();
+	if (m_appliedNodeXml && diff.IsEmpty())
+		return true;
+
 	// To prevent that we end up in a recursive ::setStateXml situation, verify that this setStateXml method is not called by itself
 	const ScopedXmlChangeLock lock(IsXmlChangeLocked());
 	if (!lock.isLocked())
@@ -360,6 +431,13 @@ bool ProtocolBridgingWrapper::SetBridgingNodeStateXml(XmlElement* stateXml, bool
 	
 	if (m_processingNode.setStateXml(stateXml))
 	{
+		// compiled config data is only dropped once the node runs with the changed config, and only where affected by the changes
+		if (m_appliedNodeXml)
+			ClearCompiledConfigCaches(diff);
+		else
+			ClearCompiledConfigCaches();
+
+		m_appliedNodeXml = std::make_unique<XmlElement>(*stateXml);
 		m_shouldUpdateNode = true; // cache if the node shall be updated (reconnected) on the next controller tick
 		if(Controller::Exists())
 			Controller::GetInstance()->EnqueueTickTrigger(); // make sure there will be a controller tick
@@ -369,7 +447,92 @@ bool ProtocolBridgingWrapper::SetBridgingNodeStateXml(XmlElement* stateXml, bool
 		return true;
 	}
 	else
+	{
+		// the node keeps running with the last applied config, so the xml config and the data compiled from it are reverted to that one
+		if (m_appliedNodeXml && m_bridgingXml.containsChildElement(stateXml))
+		{
+			*stateXml = *m_appliedNodeXml;
+			ClearCompiledConfigCaches(diff);
+		}
 		return false;
+	}
+}
+
+/**
+ * Helper to compare two bridging node xml configs.
+ * Protocols are matched by their id, to detect added, removed and changed protocols.
+ * @param	appliedNodeXml	The node xml config the node currently runs with.
+ * @param	nodeXml			The changed node xml config.
+ * @return	The differences between the two configs.
+ */
+ProtocolBridgingWrapper::NodeConfigDiff ProtocolBridgingWrapper::GetNodeConfigDiff(const XmlElement& appliedNodeXml, const XmlElement& nodeXml)
+{
+	auto diff = NodeConfigDiff();
+	if (appliedNodeXml.isEquivalentTo(&nodeXml, false))
+		return diff;
+
+	auto getProtocolXmlElements = [](const XmlElement& xml) {
+		auto protocolXmlElements = std::map<ProtocolId, const XmlElement*>();
+		for (auto childXmlElement : xml.getChildIterator())
+		{
+			if (childXmlElement->getTagName() == ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::PROTOCOLA)
+				|| childXmlElement->getTagName() == ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::PROTOCOLB))
+				protocolXmlElements[childXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID))] = childXmlElement;
+		}
+		return protocolXmlElements;
+	};
+
+	auto appliedProtocolXmlElements = getProtocolXmlElements(appliedNodeXml);
+	auto protocolXmlElements = getProtocolXmlElements(nodeXml);
+	for (auto const& protocolXmlElementKV : protocolXmlElements)
+	{
+		auto appliedProtocolXmlElementIter = appliedProtocolXmlElements.find(protocolXmlElementKV.first);
+		if (appliedProtocolXmlElementIter == appliedProtocolXmlElements.end()
+			|| appliedProtocolXmlElementIter->second->getTagName() != protocolXmlElementKV.second->getTagName()
+			|| !appliedProtocolXmlElementIter->second->isEquivalentTo(protocolXmlElementKV.second, false))
+			diff._changedProtocolIds.insert(protocolXmlElementKV.first);
+	}
+	for (auto const& appliedProtocolXmlElementKV : appliedProtocolXmlElements)
+		if (protocolXmlElements.count(appliedProtocolXmlElementKV.first) == 0)
+			diff._changedProtocolIds.insert(appliedProtocolXmlElementKV.first);
+
+	auto appliedObjectHandlingXmlElement = appliedNodeXml.getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OBJECTHANDLING));
+	auto objectHandlingXmlElement = nodeXml.getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OBJECTHANDLING));
+	if (!appliedObjectHandlingXmlElement || !objectHandlingXmlElement)
+		diff._nodeChanged = (appliedObjectHandlingXmlElement != objectHandlingXmlElement);
+	else
+		diff._nodeChanged = !appliedObjectHandlingXmlElement->isEquivalentTo(objectHandlingXmlElement, false);
+
+	// something apart from protocols and object handling differs, e.g. the node attributes
+	if (diff.IsEmpty())
+		diff._nodeChanged = true;
+
+	return diff;
+}
+
+/**
+ * Helper to drop the data that was compiled from xml config, to have it compiled again
+ * from the current config on next access. Currently this is the DS100 routing table only.
+ */
+void ProtocolBridgingWrapper::ClearCompiledConfigCaches()
+{
+	const ScopedLock l(m_ds100RoutingTableLock);
+	m_ds100RoutingTableValid = false;
+}
+
+/**
+ * Helper to drop the data that was compiled from xml config, only if it is affected by the changes.
+ * The DS100 routing table is only marked to be recomputed if the object handling or one of the DS100 protocols changed.
+ * @param	diff	The differences of the changed config to the one the compiled data is based on.
+ */
+void ProtocolBridgingWrapper::ClearCompiledConfigCaches(const NodeConfigDiff& diff)
+{
+	auto ds100Changed = std::any_of(diff._changedProtocolIds.begin(), diff._changedProtocolIds.end(), [](ProtocolId protocolId) { return GetDS100DeviceIndex(protocolId) >= 0; });
+	if (diff._nodeChanged || ds100Changed)
+	{
+		const ScopedLock l(m_ds100RoutingTableLock);
+		m_ds100RoutingTableValid = false;
+	}
 }
 
 /**
@@ -2344,6 +2507,16 @@ bool ProtocolBridgingWrapper::SetProtocolBridgingXYMessageCombined(ProtocolId pr
  */
 std::map<RemoteObjectIdentifier, std::pair<juce::String, juce::Range<float>>> ProtocolBridgingWrapper::GetProtocolOscRemapAssignments(ProtocolId protocolId)
 {
+	// lookup of remote object ids by their xml tag names, to not have to compare every remapping element against all known objects
+	static const auto s_objectTagNameToRoi = []() {
+		std::map<juce::String, RemoteObjectIdentifier> objectTagNameToRoi;
+		for (int i = ROI_Invalid + 1; i < ROI_BridgingMAX; ++i)
+			objectTagNameToRoi.insert(std::make_pair(ProcessingEngineConfig::GetObjectTagName(static_cast<RemoteObjectIdentifier>(i)), static_cast<RemoteObjectIdentifier>(i)));
+		return objectTagNameToRoi;
+	}();
+
+	std::map<RemoteObjectIdentifier, std::pair<juce::String, juce::Range<float>>> oscRemappings;
+
 	auto nodeXmlElement = m_bridgingXml.getChildByAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), String(DEFAULT_PROCNODE_ID));
 	if (nodeXmlElement)
 	{
@@ -2353,35 +2526,29 @@ std::map<RemoteObjectIdentifier, std::pair<juce::String, juce::Range<float>>> Pr
 			auto oscRemappingsXmlElement = protocolXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::REMAPPINGS));
 			if (oscRemappingsXmlElement)
 			{
-				std::map<RemoteObjectIdentifier, std::pair<juce::String, juce::Range<float>>> oscRemappings;
 				auto oscRemappingXmlElement = oscRemappingsXmlElement->getFirstChildElement();
 				while (nullptr != oscRemappingXmlElement)
 				{
-					for (int i = ROI_Invalid + 1; i < ROI_BridgingMAX; ++i)
+					auto roiIter = s_objectTagNameToRoi.find(oscRemappingXmlElement->getTagName());
+					if (roiIter != s_objectTagNameToRoi.end())
 					{
-						auto ROId = static_cast<RemoteObjectIdentifier>(i);
-						if (oscRemappingXmlElement->getTagName() == ProcessingEngineConfig::GetObjectTagName(ROId))
+						auto oscRemappingTextElement = oscRemappingXmlElement->getFirstChildElement();
+						if (oscRemappingTextElement && oscRemappingTextElement->isTextElement())
 						{
-							auto oscRemappingTextElement = oscRemappingXmlElement->getFirstChildElement();
-							if (oscRemappingTextElement && oscRemappingTextElement->isTextElement())
-							{
-								auto remapPattern = oscRemappingTextElement->getText();
-								auto minVal = static_cast<float>(oscRemappingXmlElement->getDoubleAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::MINVALUE)));
-								auto maxVal = static_cast<float>(oscRemappingXmlElement->getDoubleAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::MAXVALUE)));
-								oscRemappings.insert(std::make_pair(ROId, std::make_pair(remapPattern, juce::Range<float>(minVal, maxVal))));
-							}
+							auto remapPattern = oscRemappingTextElement->getText();
+							auto minVal = static_cast<float>(oscRemappingXmlElement->getDoubleAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::MINVALUE)));
+							auto maxVal = static_cast<float>(oscRemappingXmlElement->getDoubleAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::MAXVALUE)));
+							oscRemappings.insert(std::make_pair(roiIter->second, std::make_pair(remapPattern, juce::Range<float>(minVal, maxVal))));
 						}
 					}
 
 					oscRemappingXmlElement = oscRemappingXmlElement->getNextElement();
 				}
-
-				return oscRemappings;
 			}
 		}
 	}
 
-	return std::map<RemoteObjectIdentifier, std::pair<juce::String, juce::Range<float>>>();
+	return oscRemappings;
 }
 
 /**
@@ -2466,6 +2633,8 @@ bool ProtocolBridgingWrapper::SetProtocolOscRemapAssignments(ProtocolId protocol
  */
 std::map<int, ChannelId> ProtocolBridgingWrapper::GetProtocolChannelRemapAssignments(ProtocolId protocolId)
 {
+	std::map<int, ChannelId> channelRemappings;
+
 	auto nodeXmlElement = m_bridgingXml.getChildByAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), String(DEFAULT_PROCNODE_ID));
 	if (nodeXmlElement)
 	{
@@ -2475,16 +2644,18 @@ std::map<int, ChannelId> ProtocolBridgingWrapper::GetProtocolChannelRemapAssignm
 			auto channelRemappingsXmlElement = protocolXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::REMAPPINGS));
 			if (channelRemappingsXmlElement)
 			{
-				std::map<int, ChannelId> channelRemappings;
+				auto remappingTagName = ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::REMAPPINGS);
+				auto idAttributeName = ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID);
+
 				auto channelRemappingXmlElement = channelRemappingsXmlElement->getFirstChildElement();
 				while (nullptr != channelRemappingXmlElement)
 				{
-					if (channelRemappingXmlElement->getTagName() == ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::REMAPPINGS))
+					if (channelRemappingXmlElement->getTagName() == remappingTagName)
 					{
 						auto channelRemappingTextElement = channelRemappingXmlElement->getFirstChildElement();
 						if (channelRemappingTextElement && channelRemappingTextElement->isTextElement())
 						{
-							auto index = channelRemappingXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), -1);
+							auto index = channelRemappingXmlElement->getIntAttribute(idAttributeName, -1);
 							auto channel = ChannelId(channelRemappingTextElement->getText().getIntValue());
 							channelRemappings.insert(std::make_pair(index, channel));
 						}
@@ -2492,13 +2663,11 @@ std::map<int, ChannelId> ProtocolBridgingWrapper::GetProtocolChannelRemapAssignm
 
 					channelRemappingXmlElement = channelRemappingXmlElement->getNextElement();
 				}
-
-				return channelRemappings;
 			}
 		}
 	}
 
-	return std::map<int, ChannelId>();
+	return channelRemappings;
 }
 
 /**
@@ -2604,6 +2773,24 @@ void ProtocolBridgingWrapper::SetProtocolState(ProtocolId protocolId, ObjectHand
 	{
 		m_bridgingProtocolState[protocolId] = state;
 
+		// the master state of the DS100s in mirror mode decides where values are sent to
+		if (GetDS100DeviceIndex(protocolId) >= 0)
+		{
+			m_reconnectManager.HandleProtocolStateChange(protocolId, state);
+
+			{
+				const ScopedLock l(m_ds100RoutingTableLock);
+				m_ds100RoutingTableValid = false;
+			}
+
+			if ((state & OHS_Protocol_Master) == OHS_Protocol_Master && GetDS100ExtensionMode() == EM_Mirror)
+			{
+				auto now = juce::Time::getMillisecondCounter();
+				DBG(juce::String(__FUNCTION__) << " DS100 protocol " << protocolId << " took over as mirror master, " << int(now - m_lastDS100MasterChangeTime) << "ms after previous master change");
+				m_lastDS100MasterChangeTime = now;
+			}
+		}
+
 		if (Controller::Exists())
 		{
 			Controller::GetInstance()->SetParameterChanged(DCP_Protocol, DCT_Connected);
@@ -2822,8 +3009,8 @@ void ProtocolBridgingWrapper::SetActiveBridgingProtocols(ProtocolBridgingType de
 
 /**
  * Updates the active soundobject ids in DS100 device protocol configuration of bridging node.
- * This method gets all current active remote objects from controller, maps them to one or two (64ch vs 128ch)
- * DS100 devices and inserts them into an xml element that is then set as new config to bridging node.
+ * This method gets all current active remote objects from controller, maps them to the DS100 devices
+ * (64ch per device in extension mode) and inserts them into an xml element that is then set as new config to bridging node.
  * @param	activeObjects			The objects to set as new active ones in bridging xml (and update RPBC with it)
  * @param	dontSendNotification	Flag if the app configuration should be triggered to be updated
  * @return	True on succes, false if failure
@@ -2838,86 +3025,183 @@ bool ProtocolBridgingWrapper::UpdateActiveDS100RemoteObjectIds(const std::vector
 	if (!objectHandlingXmlElement)
 		return false;
 
-	auto ctrl = Controller::GetInstance();
-	if (!ctrl)
-		return false;
-
-	auto extensionMode = ctrl->GetExtensionMode();
-
-	auto activeObjectsOnFirstDS100 = std::vector<RemoteObject>{};
-	auto activeObjectsOnSecondDS100 = std::vector<RemoteObject>{};
+	auto activeObjectsOnDS100 = std::array<std::vector<RemoteObject>, DS100_EXTMODE_DEVICECOUNT>{};
 	for (auto const& ro : activeObjects)
 	{
-		auto objectId = ro._Addr._first;
-
-		switch (extensionMode)
+		auto route = GetDS100ChannelRoute(static_cast<std::int32_t>(ro._Addr._first));
+		for (auto i = 0; i < route._activeObjectTargetCount; i++)
 		{
-		case EM_Off:
-			// We do not support anything exceeding one DS100 channelcount wise
-			if (objectId <= DS100_CHANNELCOUNT)
-				activeObjectsOnFirstDS100.push_back(ro);
-			break;
-		case EM_Extend:
-			// We do not support anything exceeding two DS100 (ext. mode) channelcount wise
-			if (objectId > DS100_EXTMODE_CHANNELCOUNT)
-				break;
+			auto& activeObjectsOnTargetDS100 = activeObjectsOnDS100[GetDS100DeviceIndex(route._activeObjectTargets[i]._protocolId)];
+			activeObjectsOnTargetDS100.push_back(ro);
+			activeObjectsOnTargetDS100.back()._Addr._first = route._activeObjectTargets[i]._channel;
+		}
+	}
 
-			// If the soundobjectId is out of range for a single DS100, take it as relevant 
-			// for second and map the soundobjectId back into a single DS100's source range
-			if (objectId > DS100_CHANNELCOUNT)
-			{
-				activeObjectsOnSecondDS100.push_back(ro);
-				activeObjectsOnSecondDS100.back()._Addr._first = static_cast<int>(objectId - DS100_CHANNELCOUNT);
-			}
-			// Otherwise simply take it as relevant for first DS100
-			else
-			{
-				activeObjectsOnFirstDS100.push_back(ro);
-			}
-			break;
-		case EM_Parallel:
-		case EM_Mirror:
-			// We do not support anything exceeding one DS100 channelcount wise
-			if (objectId <= DS100_CHANNELCOUNT)
+	// insert active objects for each DS100 into its xml element
+	for (auto i = 0; i < DS100_EXTMODE_DEVICECOUNT; i++)
+	{
+		auto protocolXmlElement = nodeXmlElement->getChildByAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), String(DS100_PROCESSINGPROTOCOL_IDS[i]));
+		if (protocolXmlElement)
+		{
+			auto activeObjsXmlElement = protocolXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::ACTIVEOBJECTS));
+			if (!activeObjsXmlElement)
 			{
-				activeObjectsOnFirstDS100.push_back(ro);
-				activeObjectsOnSecondDS100.push_back(ro);
+				activeObjsXmlElement = protocolXmlElement->createNewChildElement(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::ACTIVEOBJECTS));
 			}
-			break;
-		default:
-			break;
+			ProcessingEngineConfig::WriteActiveObjects(activeObjsXmlElement, activeObjectsOnDS100[i]);
 		}
+		// first DS100 existence is mandatory, we can assume that an error occured if the corresp. xml element is not available (further DS100 xml elements are optional)
+		else if (i == 0)
+			return false;
 	}
 
-	// insert active objects for first DS100 into its xml element
-	auto protocolXmlElement1stDS100 = nodeXmlElement->getChildByAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), String(DS100_1_PROCESSINGPROTOCOL_ID));
-	if (protocolXmlElement1stDS100)
+	// set updated xml config live
+	return SetBridgingNodeStateXml(nodeXmlElement, dontSendNotification);
+}
+
+/**
+ * Checks if data received from the given protocol shall be handled at all.
+ * In parallel extension mode, only data received from the currently active DS100 is handled.
+ * @param	senderProtocolId	The id of the protocol the data was received from.
+ * @return	True if the data shall be handled, false if it shall be ignored.
+ */
+bool ProtocolBridgingWrapper::IsReceptionFromProtocolEnabled(ProtocolId senderProtocolId)
+{
+	const ScopedLock l(m_ds100RoutingTableLock);
+	if (!m_ds100RoutingTableValid)
+		UpdateDS100RoutingTable();
+
+	if (m_ds100RoutingTable._extensionMode != EM_Parallel)
+		return true;
+
+	if (m_ds100RoutingTable._activeParallelModeDS100Index < 0)
+		return true;
+
+	// Do not handle any protocol data from other DS100 than the one set as active one in parallel extension mode
+	return GetDS100DeviceIndex(senderProtocolId) == m_ds100RoutingTable._activeParallelModeDS100Index;
+}
+
+/**
+ * Gets the offset to add to channels received from the given protocol, to get the application channel.
+ * This is only non-zero for the further DS100 in extend mode, that serve the channels above the preceding DS100's channelcount.
+ * @param	senderProtocolId	The id of the protocol the data was received from.
+ * @return	The channel offset.
+ */
+std::int32_t ProtocolBridgingWrapper::GetDS100ChannelOffset(ProtocolId senderProtocolId)
+{
+	const ScopedLock l(m_ds100RoutingTableLock);
+	if (!m_ds100RoutingTableValid)
+		UpdateDS100RoutingTable();
+
+	auto deviceIndex = GetDS100DeviceIndex(senderProtocolId);
+	if (m_ds100RoutingTable._extensionMode == EM_Extend && deviceIndex > 0)
+		return static_cast<std::int32_t>(deviceIndex * DS100_CHANNELCOUNT);
+
+	return 0;
+}
+
+/**
+ * Helper to recompute the DS100 routing table from the current xml config and DS100 master state.
+ * Must be called with the routing table lock held.
+ */
+void ProtocolBridgingWrapper::UpdateDS100RoutingTable()
+{
+	m_ds100RoutingTable._extensionMode = GetDS100ExtensionMode();
+	m_ds100RoutingTable._activeParallelModeDS100 = GetActiveParallelModeDS100();
+	// the active parallel mode DS100 values follow the DS100 device order, starting with APM_1st
+	auto activeParallelModeDS100Index = static_cast<int>(m_ds100RoutingTable._activeParallelModeDS100) - static_cast<int>(APM_1st);
+	m_ds100RoutingTable._activeParallelModeDS100Index = (activeParallelModeDS100Index >= 0 && activeParallelModeDS100Index < DS100_EXTMODE_DEVICECOUNT) ? activeParallelModeDS100Index : -1;
+
+	m_ds100RoutingTable._channelRoutes.resize(DS100_EXTMODE_CHANNELCOUNT + 1);
+	for (auto channel = 0; channel <= DS100_EXTMODE_CHANNELCOUNT; channel++)
+		m_ds100RoutingTable._channelRoutes[channel] = CreateDS100ChannelRoute(channel);
+
+	m_ds100RoutingTableValid = true;
+}
+
+/**
+ * Helper to compute the DS100 targets of a single application channel
+ * for the extension mode that is set in the routing table.
+ * @param	channel		The application channel to compute the targets for.
+ * @return	The computed route.
+ */
+ProtocolBridgingWrapper::DS100ChannelRoute ProtocolBridgingWrapper::CreateDS100ChannelRoute(std::int32_t channel) const
+{
+	auto route = DS100ChannelRoute();
+	auto addSendTarget = [&route](ProtocolId protocolId, std::int32_t targetChannel) { route._sendTargets[route._sendTargetCount++] = { protocolId, targetChannel }; };
+	auto addActiveObjectTarget = [&route](ProtocolId protocolId, std::int32_t targetChannel) { route._activeObjectTargets[route._activeObjectTargetCount++] = { protocolId, targetChannel }; };
+
+	switch (m_ds100RoutingTable._extensionMode)
 	{
-		auto activeObjsXmlElement = protocolXmlElement1stDS100->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::ACTIVEOBJECTS));
-		if (!activeObjsXmlElement)
+	case EM_Mirror:
+		// only the first DS100 that currently is master gets data sent
+		for (auto const& protocolId : DS100_PROCESSINGPROTOCOL_IDS)
 		{
-			activeObjsXmlElement = protocolXmlElement1stDS100->createNewChildElement(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::ACTIVEOBJECTS));
+			if ((GetProtocolState(protocolId) & OHS_Protocol_Master) == OHS_Protocol_Master)
+			{
+				addSendTarget(protocolId, channel);
+				break;
+			}
 		}
-		ProcessingEngineConfig::WriteActiveObjects(activeObjsXmlElement, activeObjectsOnFirstDS100);
-	}
-	// first DS100 existence is mandatory, we can assume that an error occured if the corresp. xml element is not available (second DS100 xml element is optional)
-	else
-		return false;
 
-	// insert active objects for second DS100 into its xml element
-	auto protocolXmlElement2ndDS100 = nodeXmlElement->getChildByAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), String(DS100_2_PROCESSINGPROTOCOL_ID));
-	if (protocolXmlElement2ndDS100)
-	{
-		auto activeObjsXmlElement = protocolXmlElement2ndDS100->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::ACTIVEOBJECTS));
-		if (!activeObjsXmlElement)
+		// We do not support anything exceeding one DS100 channelcount wise
+		if (channel <= DS100_CHANNELCOUNT)
+			for (auto const& protocolId : DS100_PROCESSINGPROTOCOL_IDS)
+				addActiveObjectTarget(protocolId, channel);
+		break;
+	case EM_Extend:
 		{
-			activeObjsXmlElement = protocolXmlElement2ndDS100->createNewChildElement(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::ACTIVEOBJECTS));
+			// Shard the channels in blocks of a single DS100's channelcount to the DS100s
+			// and map them back into a single DS100's channel range. Channels exceeding
+			// the extension mode channelcount are wrapped to the last DS100.
+			auto deviceIndex = jlimit(0, DS100_EXTMODE_DEVICECOUNT - 1, static_cast<int>((channel - 1) / DS100_CHANNELCOUNT));
+			auto mappedChannel = static_cast<std::int32_t>(((channel - 1) % DS100_CHANNELCOUNT) + 1);
+			addSendTarget(DS100_PROCESSINGPROTOCOL_IDS[deviceIndex], mappedChannel);
+
+			// We do not support anything exceeding all DS100 (ext. mode) channelcount wise
+			if (channel <= DS100_EXTMODE_CHANNELCOUNT)
+				addActiveObjectTarget(DS100_PROCESSINGPROTOCOL_IDS[deviceIndex], mappedChannel);
 		}
-		ProcessingEngineConfig::WriteActiveObjects(activeObjsXmlElement, activeObjectsOnSecondDS100);
+		break;
+	case EM_Parallel:
+		for (auto const& protocolId : DS100_PROCESSINGPROTOCOL_IDS)
+			addSendTarget(protocolId, channel);
+
+		// We do not support anything exceeding one DS100 channelcount wise
+		if (channel <= DS100_CHANNELCOUNT)
+			for (auto const& protocolId : DS100_PROCESSINGPROTOCOL_IDS)
+				addActiveObjectTarget(protocolId, channel);
+		break;
+	case EM_Off:
+	default:
+		addSendTarget(DS100_1_PROCESSINGPROTOCOL_ID, channel);
+
+		// We do not support anything exceeding one DS100 channelcount wise
+		if (channel <= DS100_CHANNELCOUNT)
+			addActiveObjectTarget(DS100_1_PROCESSINGPROTOCOL_ID, channel);
+		break;
 	}
 
-	// set updated xml config live
-	return SetBridgingNodeStateXml(nodeXmlElement, dontSendNotification);
+	return route;
+}
+
+/**
+ * Getter for the DS100 targets of an application channel.
+ * The routing table is recomputed first, if config or DS100 master state changed since it was last computed.
+ * Channels outside of the table range are computed on the fly.
+ * @param	channel		The application channel to get the targets for.
+ * @return	The route of the channel.
+ */
+ProtocolBridgingWrapper::DS100ChannelRoute ProtocolBridgingWrapper::GetDS100ChannelRoute(std::int32_t channel)
+{
+	const ScopedLock l(m_ds100RoutingTableLock);
+	if (!m_ds100RoutingTableValid)
+		UpdateDS100RoutingTable();
+
+	if (channel >= 0 && channel < static_cast<std::int32_t>(m_ds100RoutingTable._channelRoutes.size()))
+		return m_ds100RoutingTable._channelRoutes[channel];
+	else
+		return CreateDS100ChannelRoute(channel);
 }
 
 /**
@@ -3527,10 +3811,8 @@ bool ProtocolBridgingWrapper::SetDS100ExtensionMode(ExtensionMode mode, bool don
 					if (!protoFailoverTimeXmlElement)
 						protoFailoverTimeXmlElement = objectHandlingXmlElement->createNewChildElement(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::FAILOVERTIME));
 					auto protoFailoverTimeTextXmlElement = protoFailoverTimeXmlElement->getFirstChildElement();
-					if (protoFailoverTimeTextXmlElement && protoFailoverTimeTextXmlElement->isTextElement())
-						protoFailoverTimeTextXmlElement->setText("1000");
-					else
-						protoFailoverTimeXmlElement->addTextElement("1000");
+					if (!protoFailoverTimeTextXmlElement || !protoFailoverTimeTextXmlElement->isTextElement())
+						protoFailoverTimeXmlElement->addTextElement(String(DS100_MIRROR_FAILOVERTIME_DEF));
 
 					// update precision element
 					auto precisionXmlElement = objectHandlingXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::DATAPRECISION));
@@ -3707,6 +3989,69 @@ bool ProtocolBridgingWrapper::SetActiveParallelModeDS100(ActiveParallelModeDS100
 		return false;
 }
 
+/**
+ * Getter method for the failover time in extension mode "mirror".
+ * This does not return a member variable value but contains logic to derive the value from internal cached xml element configuration.
+ * @return The time in ms without reaction of the master DS100, after which the slave DS100 takes over, or the default if mirror mode is not configured.
+ */
+int ProtocolBridgingWrapper::GetDS100MirrorFailoverTime()
+{
+	auto nodeXmlElement = m_bridgingXml.getChildByAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), String(DEFAULT_PROCNODE_ID));
+	if (nodeXmlElement)
+	{
+		auto objectHandlingXmlElement = nodeXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OBJECTHANDLING));
+		if (objectHandlingXmlElement)
+		{
+			auto protoFailoverTimeXmlElement = objectHandlingXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::FAILOVERTIME));
+			if (protoFailoverTimeXmlElement)
+			{
+				auto protoFailoverTimeTextXmlElement = protoFailoverTimeXmlElement->getFirstChildElement();
+				if (protoFailoverTimeTextXmlElement && protoFailoverTimeTextXmlElement->isTextElement())
+					return protoFailoverTimeTextXmlElement->getText().getIntValue();
+			}
+		}
+	}
+
+	return DS100_MIRROR_FAILOVERTIME_DEF;
+}
+
+/**
+ * Setter method for the failover time in extension mode "mirror".
+ * This does not set a member variable but contains logic to reconfigure the cached xml element according to the given value.
+ * @param failoverTime	The time in ms without reaction of the master DS100, after which the slave DS100 takes over.
+ * @param dontSendNotification	Flag if the app configuration should be triggered to be updated
+ * @return	True on success, false on failure or if mirror mode is not configured.
+ */
+bool ProtocolBridgingWrapper::SetDS100MirrorFailoverTime(int failoverTime, bool dontSendNotification)
+{
+	// makes no sense to set the details of mirror extension mode when mirror mode itself is not active
+	if (GetDS100ExtensionMode() != EM_Mirror)
+		return false;
+
+	auto nodeXmlElement = m_bridgingXml.getChildByAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID), String(DEFAULT_PROCNODE_ID));
+	if (nodeXmlElement)
+	{
+		auto objectHandlingXmlElement = nodeXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OBJECTHANDLING));
+		if (objectHandlingXmlElement)
+		{
+			auto protoFailoverTimeXmlElement = objectHandlingXmlElement->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::FAILOVERTIME));
+			if (!protoFailoverTimeXmlElement)
+				protoFailoverTimeXmlElement = objectHandlingXmlElement->createNewChildElement(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::FAILOVERTIME));
+			auto protoFailoverTimeTextXmlElement = protoFailoverTimeXmlElement->getFirstChildElement();
+			if (protoFailoverTimeTextXmlElement && protoFailoverTimeTextXmlElement->isTextElement())
+				protoFailoverTimeTextXmlElement->setText(String(failoverTime));
+			else
+				protoFailoverTimeXmlElement->addTextElement(String(failoverTime));
+
+			return SetBridgingNodeStateXml(nodeXmlElement, dontSendNotification);
+		}
+		else
+			return false;
+	}
+	else
+		return false;
+}
+
 /**
  * Gets the status of the first DS100 protocol connection.
  * This forwards the call to the generic implementation that itself gets the info from BridgingWrapper.
@@ -20,6 +20,7 @@
 
 #include "SpaConBridgeCommon.h"
 #include "AppConfiguration.h"
+#include "ReconnectManager.h"
 
 #include <ProcessingEngine/ProcessingEngineNode.h>
 #include <ProcessingEngine/ObjectDataHandling/ObjectDataHandling_Abstract.h>
@@ -62,6 +63,10 @@ static constexpr int RX_PORT_ADMOSC_HOST = 50019;		//< Default UDP port to use f
 static constexpr int RX_PORT_REMAPOSC_DEVICE = 50020;	//< Default UDP port to use for Remap OSC device side
 static constexpr int RX_PORT_REMAPOSC_HOST = 50021;		//< Default UDP port to use for Remap OSC host (spaconbridge) side
 
+static constexpr int DS100_MIRROR_FAILOVERTIME_DEF = 1000;	//< Default time in ms without reaction of the master DS100 in mirror mode, after which the slave DS100 takes over
+static constexpr int DS100_MIRROR_FAILOVERTIME_MIN = 100;	//< Minimum failover time in ms in mirror mode
+static constexpr int DS100_MIRROR_FAILOVERTIME_MAX = 10000;	//< Maximum failover time in ms in mirror mode
+
 /**
  * Pre-define processing bridge config values
  */
@@ -77,6 +82,11 @@ static constexpr int ADMOSC_PROCESSINGPROTOCOL_ID = 9;
 static constexpr int DAWPLUGIN_PROCESSINGPROTOCOL_ID = 10;
 static constexpr int REMAPOSC_PROCESSINGPROTOCOL_ID = 11;
 
+/**
+ * The DS100 protocol ids, in order of the channel ranges they serve in extension mode
+ */
+static constexpr std::array<int, DS100_EXTMODE_DEVICECOUNT> DS100_PROCESSINGPROTOCOL_IDS = { DS100_1_PROCESSINGPROTOCOL_ID, DS100_2_PROCESSINGPROTOCOL_ID };
+
 class ProtocolBridgingWrapper :
 	public ProcessingEngineNode::NodeListener,
 	public AppConfiguration::XmlConfigurableElement,
@@ -117,6 +127,12 @@ public:
 	void Disconnect();
 	bool Reconnect();
 
+	//==========================================================================
+	const ReconnectManager::BackoffPolicy GetReconnectBackoffPolicy();
+	void SetReconnectBackoffPolicy(const ReconnectManager::BackoffPolicy& policy);
+	const std::vector<ReconnectManager::TimelineEntry> GetReconnectTimeline();
+	int GetReconnectTimelineEntryCount();
+
 	//==========================================================================
 	void UpdateNode();
 
@@ -132,6 +148,8 @@ public:
 
 	//==========================================================================
 	bool UpdateActiveDS100RemoteObjectIds(const std::vector<RemoteObject>& activeObjects, bool dontSendNotification = false);
+	bool IsReceptionFromProtocolEnabled(ProtocolId senderProtocolId);
+	std::int32_t GetDS100ChannelOffset(ProtocolId senderProtocolId);
 
 	ProtocolType GetDS100ProtocolType();
 	bool SetDS100ProtocolType(ProtocolType protocolType, bool dontSendNotification = false);
@@ -157,6 +175,9 @@ public:
 	ActiveParallelModeDS100 GetActiveParallelModeDS100();
 	bool SetActiveParallelModeDS100(ActiveParallelModeDS100 activeParallelModeDS100, bool dontSendNotification = false);
 
+	int GetDS100MirrorFailoverTime();
+	bool SetDS100MirrorFailoverTime(int failoverTime, bool dontSendNotification = false);
+
 	ObjectHandlingState GetDS100State() const;
 	void SetDS100State(ObjectHandlingState state);
 	ObjectHandlingState GetSecondDS100State() const;
@@ -170,6 +191,7 @@ public:
 
 	//==========================================================================
 	static bool IsBridgingObjectOnly(const RemoteObjectIdentifier roi);
+	static int GetDS100DeviceIndex(ProtocolId protocolId);
 
 	//==========================================================================
 	static const std::string GetStringRepresentationForMessageData(const RemoteObjectMessageData& msgData);
@@ -237,12 +259,68 @@ public:
 	bool SetProtocolChannelRemapAssignments(ProtocolId protocolId, const std::map<int, ChannelId>& channelRemapAssignments, bool dontSendNotification = false);
 
 private:
+	/**
+	 * A DS100 protocol and the channel on that DS100 that an application channel is mapped to.
+	 */
+	struct DS100Target
+	{
+		ProtocolId		_protocolId{ DS100_1_PROCESSINGPROTOCOL_ID };	/**< The id of the DS100 protocol. */
+		std::int32_t	_channel{ 0 };									/**< The channel on the DS100. */
+	};
+
+	/**
+	 * The DS100 targets of a single application channel, as resulting from DS100 extension mode and master state.
+	 * Fixed size, to be copied out of the routing table without allocations.
+	 */
+	struct DS100ChannelRoute
+	{
+		std::array<DS100Target, DS100_EXTMODE_DEVICECOUNT>	_sendTargets;				/**< The DS100 targets values are sent to. */
+		int							_sendTargetCount{ 0 };		/**< The count of valid send targets. */
+		std::array<DS100Target, DS100_EXTMODE_DEVICECOUNT>	_activeObjectTargets;		/**< The DS100 targets the object is activated (polled or subscribed) on. */
+		int							_activeObjectTargetCount{ 0 };	/**< The count of valid active object targets. */
+	};
+
+	/**
+	 * Routing of application channels to the DS100 protocols, computed once per
+	 * config or DS100 master state change instead of per message.
+	 */
+	struct DS100RoutingTable
+	{
+		ExtensionMode					_extensionMode{ EM_Off };			/**< The DS100 extension mode the table was computed for. */
+		ActiveParallelModeDS100			_activeParallelModeDS100{ APM_None };	/**< The active DS100 in parallel extension mode. */
+		int								_activeParallelModeDS100Index{ -1 };	/**< The DS100 device index of the active DS100 in parallel extension mode, -1 if none is active. */
+		std::vector<DS100ChannelRoute>	_channelRoutes;						/**< The routes, indexed by application channel from 0 to DS100_EXTMODE_CHANNELCOUNT. */
+	};
+
+	/**
+	 * Differences between the bridging node config the node currently runs with and a changed one.
+	 */
+	struct NodeConfigDiff
+	{
+		bool					_nodeChanged{ false };	/**< Flag if anything apart from the protocols differs, e.g. the object handling config. */
+		std::set<ProtocolId>	_changedProtocolIds;	/**< The protocols that were added, removed or whose config differs. */
+
+		bool IsEmpty() const { return !_nodeChanged && _changedProtocolIds.empty(); };
+	};
+
+	//==========================================================================
+	void UpdateDS100RoutingTable();
+	DS100ChannelRoute CreateDS100ChannelRoute(std::int32_t channel) const;
+	DS100ChannelRoute GetDS100ChannelRoute(std::int32_t channel);
+
 	//==========================================================================
 	ObjectHandlingState GetProtocolState(ProtocolId protocolId) const;
 	void SetProtocolState(ProtocolId protocolId, ObjectHandlingState state);
 
+	//==========================================================================
+	void ReconnectNode();
+	bool IsDS100RecoveryRequired();
+
 	//==========================================================================
 	bool SetBridgingNodeStateXml(XmlElement* stateXml, bool dontSendNotification = false);
+	static NodeConfigDiff GetNodeConfigDiff(const XmlElement& appliedNodeXml, const XmlElement& nodeXml);
+	void ClearCompiledConfigCaches();
+	void ClearCompiledConfigCaches(const NodeConfigDiff& diff);
 	bool SetupBridgingNode(const ProtocolBridgingType bridgingProtocolsToActivate = PBT_None);
 	std::unique_ptr<XmlElement> SetupDiGiCoBridgingProtocol();
 	std::unique_ptr<XmlElement> SetupDAWPluginBridgingProtocol();
@@ -266,9 +344,17 @@ private:
 	XmlElement											m_bridgingXml;					/**< The current xml config for bridging (contains node xml). */
 	std::map<ProtocolBridgingType, XmlElement>			m_bridgingProtocolCacheMap;		/**< Map that holds the xml config elements of bridging elements when currently not active, to be able to reactivate correct previous config on request. */
 	std::map<ProtocolId, ObjectHandlingState>			m_bridgingProtocolState;		/**< Map that holds the current protocol status as were communicated by protocol processing engine node data handling object. */
+	juce::uint32										m_lastDS100MasterChangeTime{ 0 };	/**< Time the master DS100 in mirror mode last changed, to log the time between failovers. */
+	ReconnectManager									m_reconnectManager;				/**< Keeps the timeline of DS100 state changes and reconnects, and recovers lost DS100s. */
 	std::map<ProtocolId, std::vector<RemoteObject>>		m_bridgingProtocolMutedObjects;	/**< Map that holds (caches) the currently muted objects per protocol. */
 	std::vector<ProtocolBridgingWrapper::Listener*>		m_listeners;					/**< The listner objects, for message data handling callback. */
 
+	DS100RoutingTable		m_ds100RoutingTable;				/**< Routing of application channels to DS100 protocols, derived from xml config and master state. */
+	bool					m_ds100RoutingTableValid{ false };	/**< Flag if the routing table reflects the current config and master state. */
+	juce::CriticalSection	m_ds100RoutingTableLock;			/**< Lock for the routing table, since messages are not necessarily sent and received on the same thread. */
+
+	std::unique_ptr<XmlElement>	m_appliedNodeXml;	/**< Copy of the node xml config that was last pushed to the processing node, to detect what a config change actually changes. */
+
 	bool m_shouldUpdateNode{ false };	/**< Helper flag to decide if the node shall be updated on xml change */
 	bool m_shouldBeOnline{ false };		/**< Helper flag to decide if the node shall be started when updated */
 
@@ -0,0 +1,298 @@
+/* Copyright (c) 2020-2023, Christian Ahrens
+ *
+ * This file is part of SpaConBridge <https://github.com/ChristianAhrens/SpaConBridge>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include "ReconnectManager.h"
+
+
+namespace SpaConBridge
+{
+
+
+/*
+===============================================================================
+ Class ReconnectManager
+===============================================================================
+*/
+
+/**
+ * Class constructor. The timer that checks for due recovery attempts is only started once an attempt is scheduled.
+ */
+ReconnectManager::ReconnectManager()
+{
+}
+
+/**
+ * Class destructor.
+ */
+ReconnectManager::~ReconnectManager()
+{
+	stopTimer();
+}
+
+/**
+ * Getter for the backoff parameters in use.
+ * @return	The backoff parameters.
+ */
+const ReconnectManager::BackoffPolicy ReconnectManager::GetBackoffPolicy()
+{
+	const ScopedLock l(m_lock);
+	return m_policy;
+}
+
+/**
+ * Setter for the backoff parameters. The values are limited to sensible ranges.
+ * Takes effect with the next scheduled recovery attempt.
+ * @param policy	The backoff parameters to use.
+ */
+void ReconnectManager::SetBackoffPolicy(const BackoffPolicy& policy)
+{
+	const ScopedLock l(m_lock);
+	m_policy._initialDelay = jlimit(CHECK_INTERVAL, 60000, policy._initialDelay);
+	m_policy._maxDelay = jlimit(m_policy._initialDelay, 300000, policy._maxDelay);
+	m_policy._jitter = jlimit(0, 100, policy._jitter);
+	m_policy._maxAttempts = jlimit(0, 100, policy._maxAttempts);
+}
+
+/**
+ * Method to be called on every state change of a DS100 protocol. Adds the transition to the timeline,
+ * together with the time spent in the previous state. A DS100 that goes down outside of a reconnect
+ * is regarded as lost and a recovery attempt is scheduled, if none is pending already.
+ * @param protocolId	The DS100 protocol that changed its state.
+ * @param state			The new state of the protocol.
+ */
+void ReconnectManager::HandleProtocolStateChange(ProtocolId protocolId, ObjectHandlingState state)
+{
+	const ScopedLock l(m_lock);
+
+	auto& tracking = m_protocolTracking[protocolId];
+	if (tracking._state == state)
+		return;
+
+	auto now = juce::Time::getMillisecondCounter();
+	auto wasUp = ((tracking._state & OHS_Protocol_Up) == OHS_Protocol_Up);
+	auto isUp = ((state & OHS_Protocol_Up) == OHS_Protocol_Up);
+
+	AddTimelineEntry(TET_StateChange, protocolId, GetStateName(tracking._state) + " > " + GetStateName(state), tracking._stateSince != 0 ? static_cast<int>(now - tracking._stateSince) : -1);
+
+	if (isUp && !wasUp)
+	{
+		if (tracking._reconnectedAt != 0)
+			AddTimelineEntry(TET_Connected, protocolId, "Up after reconnect", static_cast<int>(now - tracking._reconnectedAt));
+		if (tracking._lostSince != 0)
+			AddTimelineEntry(TET_Recovered, protocolId, "Recovered after " + String(m_attempt) + " attempt(s)", static_cast<int>(now - tracking._lostSince));
+
+		tracking._reconnectedAt = 0;
+		tracking._lostSince = 0;
+
+		// stop the recovery attempts once no DS100 is lost anymore
+		if (std::none_of(m_protocolTracking.begin(), m_protocolTracking.end(), [](const auto& trackingKV) { return trackingKV.second._lostSince != 0; }))
+		{
+			m_attempt = 0;
+			m_nextAttemptTime = 0;
+			stopTimer();
+		}
+	}
+	else if (wasUp && !isUp && tracking._reconnectedAt == 0)
+	{
+		tracking._lostSince = now;
+
+		if (m_nextAttemptTime == 0 && m_attempt == 0)
+			ScheduleRecoveryAttempt(now);
+	}
+
+	tracking._state = state;
+	tracking._stateSince = now;
+}
+
+/**
+ * Method to be called right before the bridging node is reconnected on request, e.g. on config change.
+ * Adds the reconnect to the timeline and restarts the recovery of DS100s that are currently lost.
+ */
+void ReconnectManager::HandleReconnect()
+{
+	const ScopedLock l(m_lock);
+
+	auto now = juce::Time::getMillisecondCounter();
+
+	AddTimelineEntry(TET_Reconnect, -1, "Reconnect", -1);
+
+	for (auto& trackingKV : m_protocolTracking)
+		trackingKV.second._reconnectedAt = now;
+
+	m_attempt = 0;
+	m_nextAttemptTime = 0;
+	if (std::any_of(m_protocolTracking.begin(), m_protocolTracking.end(), [](const auto& trackingKV) { return trackingKV.second._lostSince != 0; }))
+		ScheduleRecoveryAttempt(now);
+	else
+		stopTimer();
+}
+
+/**
+ * Getter for a copy of the timeline entries.
+ * @return	The timeline entries, oldest first.
+ */
+const std::vector<ReconnectManager::TimelineEntry> ReconnectManager::GetTimeline()
+{
+	const ScopedLock l(m_lock);
+	return std::vector<TimelineEntry>(m_timeline.begin(), m_timeline.end());
+}
+
+/**
+ * Getter for the count of timeline entries that were ever added,
+ * to be able to detect changes without copying the timeline.
+ * @return	The count of entries ever added.
+ */
+int ReconnectManager::GetTimelineEntryCount()
+{
+	const ScopedLock l(m_lock);
+	return m_timelineEntryCount;
+}
+
+/**
+ * Reimplemented from Timer to reconnect the bridging node when a recovery attempt is due.
+ * The attempt is skipped and the recovery stopped if it is no longer required (e.g. when going
+ * offline or while a DS100 is still up). The timer is stopped while no attempt is scheduled.
+ */
+void ReconnectManager::timerCallback()
+{
+	{
+		const ScopedLock l(m_lock);
+		if (m_nextAttemptTime == 0)
+		{
+			stopTimer();
+			return;
+		}
+		if (static_cast<int>(juce::Time::getMillisecondCounter() - m_nextAttemptTime) < 0)
+			return;
+
+		m_nextAttemptTime = 0;
+	}
+
+	// the callbacks are invoked without holding the lock, since reconnecting reports protocol states back to us
+	if (!isRecoveryRequired || !isRecoveryRequired() || !onRecoveryAttempt)
+	{
+		const ScopedLock l(m_lock);
+		m_attempt = 0;
+		if (m_nextAttemptTime == 0)
+			stopTimer();
+		return;
+	}
+
+	{
+		const ScopedLock l(m_lock);
+
+		auto now = juce::Time::getMillisecondCounter();
+
+		m_attempt++;
+		AddTimelineEntry(TET_RecoveryAttempt, -1, "Recovery attempt " + String(m_attempt) + "/" + String(m_policy._maxAttempts), m_nextAttemptDelay);
+
+		// mark the reconnect before it happens, to not regard the DS100s going down by it as lost
+		for (auto& trackingKV : m_protocolTracking)
+			trackingKV.second._reconnectedAt = now;
+
+		if (m_attempt < m_policy._maxAttempts)
+			ScheduleRecoveryAttempt(now);
+		else
+		{
+			AddTimelineEntry(TET_GaveUp, -1, "Gave up recovery", -1);
+			stopTimer();
+		}
+	}
+
+	onRecoveryAttempt();
+}
+
+/**
+ * Helper to add an entry to the timeline and drop the oldest entries exceeding the timeline length.
+ * The lock is expected to be held by the caller.
+ * @param type			The kind of event.
+ * @param protocolId	The DS100 protocol the event refers to, -1 for node wide events.
+ * @param description	Readable description of the event.
+ * @param duration		The duration the event refers to, in ms. -1 if not applicable.
+ */
+void ReconnectManager::AddTimelineEntry(TimelineEventType type, ProtocolId protocolId, const juce::String& description, int duration)
+{
+	auto entry = TimelineEntry();
+	entry._time = juce::Time::getCurrentTime();
+	entry._type = type;
+	entry._protocolId = protocolId;
+	entry._description = description;
+	entry._duration = duration;
+
+	DBG(juce::String(__FUNCTION__) << " " << protocolId << " " << description << (duration >= 0 ? (" (" + juce::String(duration) + "ms)") : juce::String()));
+
+	m_timeline.push_back(entry);
+	while (m_timeline.size() > static_cast<size_t>(TIMELINE_LENGTH))
+		m_timeline.pop_front();
+
+	m_timelineEntryCount++;
+}
+
+/**
+ * Helper to schedule the next recovery attempt with the backoff delay of the current attempt count
+ * and to start the timer that checks for the attempt being due, if not running yet.
+ * The lock is expected to be held by the caller.
+ * @param now	The current time, in ms.
+ */
+void ReconnectManager::ScheduleRecoveryAttempt(juce::uint32 now)
+{
+	if (m_attempt >= m_policy._maxAttempts)
+		return;
+
+	m_nextAttemptDelay = GetAttemptDelay(m_attempt);
+	m_nextAttemptTime = now + static_cast<juce::uint32>(m_nextAttemptDelay);
+
+	if (!isTimerRunning())
+		startTimer(CHECK_INTERVAL);
+}
+
+/**
+ * Helper to calculate the delay before a recovery attempt. The delay doubles with every attempt,
+ * up to the maximum delay, and is randomly varied by the jitter to not have the attempts of
+ * several instances run in lockstep.
+ * @param attempt	The count of attempts already done.
+ * @return	The delay, in ms.
+ */
+int ReconnectManager::GetAttemptDelay(int attempt)
+{
+	auto delay = jmin(static_cast<double>(m_policy._maxDelay), m_policy._initialDelay * std::pow(2.0, attempt));
+	auto jitter = delay * 0.01 * m_policy._jitter * (2.0 * m_random.nextDouble() - 1.0);
+
+	return jmax(CHECK_INTERVAL, roundToInt(delay + jitter));
+}
+
+/**
+ * Helper to get a readable name of a protocol state.
+ * @param state	The state to get the name for.
+ * @return	The readable state name.
+ */
+juce::String ReconnectManager::GetStateName(ObjectHandlingState state)
+{
+	if (state == OHS_Invalid)
+		return "Unknown";
+
+	auto name = juce::String(((state & OHS_Protocol_Up) == OHS_Protocol_Up) ? "Up" : "Down");
+	if ((state & OHS_Protocol_Master) == OHS_Protocol_Master)
+		name += " (master)";
+
+	return name;
+}
+
+
+} // namespace SpaConBridge
@@ -0,0 +1,139 @@
+/* Copyright (c) 2020-2023, Christian Ahrens
+ *
+ * This file is part of SpaConBridge <https://github.com/ChristianAhrens/SpaConBridge>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "SpaConBridgeCommon.h"
+
+#include <ProcessingEngine/ObjectDataHandling/ObjectDataHandling_Abstract.h>
+
+
+namespace SpaConBridge
+{
+
+
+/**
+ * Class ReconnectManager keeps a timeline of the DS100 protocol state transitions and the reconnects
+ * of the bridging node, with the time spent in each state, to make the time to recovery after network
+ * outages visible. When a DS100 that was up is lost while online, it triggers reconnects with
+ * exponentially growing delays, randomized by a jitter, until all DS100s are up again or the
+ * maximum count of attempts is reached. Each attempt is only made if the isRecoveryRequired
+ * callback confirms it, and the timer checking for due attempts only runs while one is scheduled.
+ */
+class ReconnectManager : private juce::Timer
+{
+public:
+	/**
+	 * The parameters of the exponential backoff between reconnect attempts.
+	 */
+	struct BackoffPolicy
+	{
+		int	_initialDelay{ 500 };	/**< The delay before the first reconnect attempt, in ms. */
+		int	_maxDelay{ 30000 };		/**< The upper limit of the delay between reconnect attempts, in ms. */
+		int	_jitter{ 20 };			/**< The random deviation applied to each delay, in percent of the delay. */
+		int	_maxAttempts{ 8 };		/**< The count of reconnect attempts before giving up. */
+	};
+
+	/**
+	 * The kinds of events in the timeline.
+	 */
+	enum TimelineEventType
+	{
+		TET_StateChange,	/**< A DS100 protocol changed its state. */
+		TET_Connected,		/**< A DS100 protocol came up after the bridging node was reconnected. */
+		TET_Recovered,		/**< A DS100 protocol that was lost is up again. */
+		TET_Reconnect,		/**< The bridging node was reconnected on request, e.g. on config change. */
+		TET_RecoveryAttempt,/**< The bridging node was reconnected to recover a lost DS100. */
+		TET_GaveUp,			/**< The maximum count of recovery attempts was reached. */
+	};
+
+	/**
+	 * A single entry in the timeline.
+	 */
+	struct TimelineEntry
+	{
+		juce::Time			_time;						/**< The time the event occured at. */
+		TimelineEventType	_type{ TET_StateChange };	/**< The kind of event. */
+		ProtocolId			_protocolId{ -1 };			/**< The DS100 protocol the event refers to, -1 for node wide events. */
+		juce::String		_description;				/**< Readable description of the event. */
+		int					_duration{ -1 };			/**< The duration the event refers to, e.g. the time spent in the previous state, in ms. -1 if not applicable. */
+	};
+
+	static constexpr int	TIMELINE_LENGTH = 100;		//< Count of entries the timeline holds before the oldest are dropped.
+	static constexpr int	CHECK_INTERVAL = 100;		//< Interval at which due reconnect attempts are checked, in ms.
+
+public:
+	ReconnectManager();
+	~ReconnectManager() override;
+
+	//==========================================================================
+	const BackoffPolicy GetBackoffPolicy();
+	void SetBackoffPolicy(const BackoffPolicy& policy);
+
+	//==========================================================================
+	void HandleProtocolStateChange(ProtocolId protocolId, ObjectHandlingState state);
+	void HandleReconnect();
+
+	//==========================================================================
+	const std::vector<TimelineEntry> GetTimeline();
+	int GetTimelineEntryCount();
+
+	//==========================================================================
+	std::function<bool()>	isRecoveryRequired;		/**< Callback to query if a reconnect is required to recover the DS100s, e.g. if the application is online and none of the DS100s in use is up. */
+	std::function<void()>	onRecoveryAttempt;		/**< Callback to reconnect the bridging node to recover a lost DS100. */
+
+private:
+	/**
+	 * The state of a single DS100 protocol as tracked for the timeline.
+	 */
+	struct ProtocolTracking
+	{
+		ObjectHandlingState	_state{ OHS_Invalid };	/**< The current state of the protocol. */
+		juce::uint32		_stateSince{ 0 };		/**< Time the current state was entered at, in ms. */
+		juce::uint32		_lostSince{ 0 };		/**< Time the protocol was lost at, in ms. 0 if not lost. */
+		juce::uint32		_reconnectedAt{ 0 };	/**< Time of the last reconnect the protocol did not come up after yet, in ms. 0 if none. */
+	};
+
+	//==========================================================================
+	void timerCallback() override;
+
+	//==========================================================================
+	void AddTimelineEntry(TimelineEventType type, ProtocolId protocolId, const juce::String& description, int duration);
+	void ScheduleRecoveryAttempt(juce::uint32 now);
+	int GetAttemptDelay(int attempt);
+	static juce::String GetStateName(ObjectHandlingState state);
+
+	//==========================================================================
+	BackoffPolicy							m_policy;					/**< The backoff parameters in use. */
+	std::map<ProtocolId, ProtocolTracking>	m_protocolTracking;			/**< The tracked state per DS100 protocol. */
+	std::deque<TimelineEntry>				m_timeline;					/**< The timeline entries, oldest first. */
+	int										m_timelineEntryCount{ 0 };	/**< Count of entries ever added, to let the ui detect changes. */
+	int										m_attempt{ 0 };				/**< Count of recovery attempts since a DS100 was lost. */
+	juce::uint32							m_nextAttemptTime{ 0 };		/**< Time the next recovery attempt is due at, in ms. 0 if none is scheduled. */
+	int										m_nextAttemptDelay{ 0 };	/**< The delay the next recovery attempt was scheduled with, in ms. */
+	juce::Random							m_random;					/**< Random generator for the jitter. */
+	juce::CriticalSection					m_lock;						/**< Lock, since protocol states are not necessarily reported on the message thread. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReconnectManager)
+};
+
+
+} // namespace SpaConBridge
@@ -225,10 +225,11 @@ static const std::string UNIT_HOUR = " h";
 static const std::string UNIT_DECIBEL = " dB";
 
 /**
- * Channelcount of a DS100 device
+ * Channelcount of a DS100 device and count of DS100 devices combined in extension mode
  */
 static constexpr int DS100_CHANNELCOUNT = 64;
-static constexpr int DS100_EXTMODE_CHANNELCOUNT = 2 * DS100_CHANNELCOUNT;
+static constexpr int DS100_EXTMODE_DEVICECOUNT = 2;
+static constexpr int DS100_EXTMODE_CHANNELCOUNT = DS100_EXTMODE_DEVICECOUNT * DS100_CHANNELCOUNT;
 
 /**
  * Bridging ObjectHandlingMode parameters